@@ -0,0 +1,69 @@
+#pragma once
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
+
+// one frame driver for the whole scene. consumers call requestFrame() while they still have work for the next frame,
+// the clock stops ticking on its own once a frame passes without any request
+class AnimationClock : public QObject {
+	Q_OBJECT
+public:
+	explicit AnimationClock(QObject * parent = nullptr);
+	AnimationClock(const AnimationClock & other) = delete;
+	AnimationClock(AnimationClock && other) = delete;
+	AnimationClock & operator=(const AnimationClock & other) = delete;
+	AnimationClock & operator=(AnimationClock && other) = delete;
+
+	void requestFrame() noexcept;
+	// ms since the clock was created
+	[[nodiscard]]
+	qint64 now() const noexcept;
+
+private:
+	void advance() noexcept;
+
+	///
+	constexpr static int32_t frameInterval = 16; // ms
+	QTimer m_timer;
+	QElapsedTimer m_elapsed;
+	qint64 m_lastTick = 0;
+	bool m_frameRequested = false;
+
+signals:
+	// delta is the ms since the previous tick
+	void tick(qint64 now, qint64 delta);
+};
+
+inline AnimationClock::AnimationClock(QObject * parent) : QObject(parent) {
+	m_timer.setInterval(frameInterval);
+	m_timer.setTimerType(Qt::PreciseTimer);
+	connect(&m_timer, &QTimer::timeout, this, &AnimationClock::advance);
+	m_elapsed.start();
+}
+
+inline void AnimationClock::requestFrame() noexcept {
+	m_frameRequested = true;
+
+	if(!m_timer.isActive()) {
+		m_lastTick = now(); // first delta after being idle is one frame, not the idle time
+		m_timer.start();
+	}
+}
+
+inline qint64 AnimationClock::now() const noexcept {
+	return m_elapsed.elapsed();
+}
+
+inline void AnimationClock::advance() noexcept {
+	const qint64 current = now();
+	const qint64 delta = current - m_lastTick;
+	m_lastTick = current;
+	m_frameRequested = false;
+
+	emit tick(current, delta);
+
+	if(!m_frameRequested) {
+		m_timer.stop();
+	}
+}
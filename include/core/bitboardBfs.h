@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "core/gridModel.h"
+#include "core/searchStats.h"
+
+// BFS over bit masks for distance-only and reachability queries on 4-connected grids, costs ignored.
+// a row is a run of 64-bit words, one bit per column, so a whole level is shift / or / and-not over every active row
+// (four words per instruction with AVX2). no parents are kept, use BfsSolver when the path itself is needed
+class BitboardBfs {
+public:
+	explicit BitboardBfs(const GridModel & grid);
+	BitboardBfs(const BitboardBfs & other) = delete;
+	BitboardBfs(BitboardBfs && other) = delete;
+	BitboardBfs & operator=(const BitboardBfs & other) = delete;
+	BitboardBfs & operator=(BitboardBfs && other) = delete;
+
+	// rereads the blocks of the grid, needed after every edit of it
+	void sync() noexcept;
+	// moves from source to target, GridModel::npos if target cannot be reached
+	[[nodiscard]]
+	uint32_t distance(uint32_t source, uint32_t target) noexcept;
+	// cells reachable from source, source included
+	[[nodiscard]]
+	uint64_t reachableCount(uint32_t source) noexcept;
+	// of the last query: expanded counts every cell reached, pathLength is the distance found
+	[[nodiscard]]
+	const SearchStats & stats() const noexcept;
+
+private:
+	// floods level by level from source until target is reached or nothing new is, returns the levels walked
+	uint32_t flood(uint32_t source, uint32_t target) noexcept;
+	// next = neighbours of current that are passable and not visited yet, over rows [rowBegin, rowEnd). returns the cells added
+	[[nodiscard]]
+	uint64_t expandRows(size_t rowBegin, size_t rowEnd) noexcept;
+	[[nodiscard]]
+	size_t wordIndex(uint32_t row, uint32_t col) const noexcept;
+
+	///
+	constexpr static size_t wordBits = 64;
+	constexpr static size_t vectorWords = 4; // rows are padded to whole AVX2 vectors
+
+	const GridModel & m_grid;
+	size_t m_rowWords;			   // words holding the columns of one row
+	size_t m_stride;			   // a zero guard word on both sides of every row, and a zero guard row above and below the grid
+	std::vector<uint64_t> m_passable;
+	std::vector<uint64_t> m_visited;
+	std::vector<uint64_t> m_current;
+	std::vector<uint64_t> m_next;
+	SearchStats m_stats;
+};
+
+inline const SearchStats & BitboardBfs::stats() const noexcept {
+	return m_stats;
+}
+
+inline size_t BitboardBfs::wordIndex(const uint32_t row, const uint32_t col) const noexcept {
+	return (row + 1) * m_stride + 1 + col / wordBits;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "core/gridModel.h"
+#include "core/stampedBuffer.h"
+
+// connected components of the open cells under 4-neighbour moves, a union-find forest over the cells. costs do not matter,
+// only blocks separate components. edits are reported through invalidate() and applied by refresh(): an opened cell is
+// united with its open neighbours in near O(1). a closed cell whose open neighbours still meet, around its 8 surrounding
+// cells or within a small flood, cannot split anything and just leaves its component. any other closure may split one and
+// union-find cannot undo a union, so the whole forest is rebuilt in one linear pass instead
+class ComponentIndex {
+public:
+	explicit ComponentIndex(const GridModel & grid);
+	ComponentIndex(const ComponentIndex & other) = delete;
+	ComponentIndex(ComponentIndex && other) = delete;
+	ComponentIndex & operator=(const ComponentIndex & other) = delete;
+	ComponentIndex & operator=(ComponentIndex && other) = delete;
+
+	// cell changed its block since the last refresh(). a resized grid is noticed without being reported
+	void invalidate(uint32_t cell) noexcept;
+	void invalidateAll() noexcept;
+	// brings the forest up to the grid, the queries below answer for the grid as of the last call
+	void refresh() noexcept;
+	// whether a path joins the two cells, false if either is a block
+	[[nodiscard]]
+	bool connected(uint32_t first, uint32_t second) noexcept;
+	// one cell standing for the component of cell, the same for all its cells. GridModel::npos for blocks
+	[[nodiscard]]
+	uint32_t component(uint32_t cell) noexcept;
+	// full passes over the lifetime of the index, the first one included
+	[[nodiscard]]
+	uint64_t rebuilds() const noexcept;
+
+private:
+	void rebuild() noexcept;
+	void open(uint32_t cell) noexcept;
+	void close(uint32_t cell) noexcept;
+	// the open neighbours of cell are joined through its open surrounding cells, so closing it splits nothing
+	[[nodiscard]]
+	bool ringConnected(uint32_t cell) const noexcept;
+	// the same through a flood of at most localBudget open cells from one of the neighbours
+	[[nodiscard]]
+	bool locallyConnected(uint32_t cell) noexcept;
+	[[nodiscard]]
+	uint32_t find(uint32_t cell) noexcept;
+	void unite(uint32_t first, uint32_t second) noexcept;
+
+	///
+	constexpr static size_t localBudget = 1024;
+
+	const GridModel & m_grid;
+	std::vector<uint32_t> m_parent; // npos for cells closed at the last rebuild. later closed ones stay in the forest as links
+	std::vector<uint32_t> m_size;	// cells in the tree of every root, closed links included
+	std::vector<uint8_t> m_open;	// as the forest was last told
+	std::vector<uint32_t> m_edited;
+	uint32_t m_rowCnt = 0; // dimensions the forest was built for
+	uint32_t m_colCnt = 0;
+	bool m_stale = true;
+	StampedSet m_seen; // scratch of locallyConnected
+	std::vector<uint32_t> m_localQueue;
+	uint64_t m_rebuilds = 0;
+};
+
+inline ComponentIndex::ComponentIndex(const GridModel & grid) : m_grid(grid) {
+}
+
+inline void ComponentIndex::invalidateAll() noexcept {
+	m_stale = true;
+	m_edited.clear();
+}
+
+inline uint64_t ComponentIndex::rebuilds() const noexcept {
+	return m_rebuilds;
+}
+
+inline bool ComponentIndex::connected(const uint32_t first, const uint32_t second) noexcept {
+	const uint32_t root = component(first);
+	return root != GridModel::npos && root == component(second);
+}
+
+inline uint32_t ComponentIndex::component(const uint32_t cell) noexcept {
+	return m_open[cell] ? find(cell) : GridModel::npos;
+}
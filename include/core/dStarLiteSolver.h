@@ -0,0 +1,95 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include "core/searchSolver.h"
+
+// D* Lite (Koenig & Likhachev): A* run backwards from the target, whose g / rhs values outlive the run. the next start()
+// towards the same target only repairs them: cells reported through invalidate() are re-examined and a moved source just
+// raises the key offset, so the work follows the size of the edit rather than the grid. a new target, a resized grid or
+// invalidateAll() starts over. costs are paid like Dijkstra and paths are optimal. one step() settles or unsettles one cell;
+// the last step reports the source once its value is final, also when nothing needed repairing
+class DStarLiteSolver : public SearchSolver {
+	using Key = std::pair<uint64_t, uint64_t>; // {min(g, rhs) + estimate + offset, min(g, rhs)}
+
+	struct Entry {
+		Key key;
+		uint32_t cell;
+
+		[[nodiscard]]
+		bool operator>(const Entry & other) const noexcept;
+	};
+
+public:
+	using SearchSolver::SearchSolver;
+
+	// cell changed its block or cost since the last start()
+	void invalidate(uint32_t cell) noexcept;
+	void invalidateAll() noexcept;
+	// whether the last start() kept the values of the run before it
+	[[nodiscard]]
+	bool repaired() const noexcept;
+	[[nodiscard]]
+	std::vector<uint32_t> path() const noexcept override;
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+	[[nodiscard]]
+	bool reachedTarget() const noexcept override;
+	// the neighbour the path leaves m_current through, towards the target
+	[[nodiscard]]
+	uint32_t currentParent() const noexcept override;
+
+private:
+	// every value back to unknown with only the target queued
+	void restart() noexcept;
+	// rhs of cell from its neighbours, then (re)queued if it is inconsistent
+	void updateCell(uint32_t cell) noexcept;
+	// neighbour of cell with the cheapest cost + g, GridModel::npos if none is finite
+	[[nodiscard]]
+	uint32_t bestSuccessor(uint32_t cell) const noexcept;
+	// drops entries of cells that were requeued or settled since, false once nothing live is left
+	[[nodiscard]]
+	bool liveTop() noexcept;
+	[[nodiscard]]
+	Key calculateKey(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	bool finished() noexcept;
+
+	///
+	constexpr static uint32_t infinity = UINT32_MAX;
+
+	std::vector<uint32_t> m_g;
+	std::vector<uint32_t> m_rhs;
+	std::vector<Key> m_queuedKey;	 // key of the live entry of every queued cell
+	std::vector<uint8_t> m_queued;
+	std::vector<Entry> m_openList; // min-heap through std::push_heap, lazily deleted against m_queuedKey / m_queued
+	std::vector<uint32_t> m_edited;
+	bool m_editedAll = true;
+	uint32_t m_lastSource = GridModel::npos;
+	uint32_t m_lastTarget = GridModel::npos;
+	uint32_t m_colCnt = 0; // of the grid the values belong to, with the cell count it tells a resize apart
+	uint64_t m_keyOffset = 0; // km, the estimates that went stale by moving the source
+	bool m_repaired = false;
+	bool m_done = false; // the source was reported, so its value is final
+};
+
+inline bool DStarLiteSolver::Entry::operator>(const Entry & other) const noexcept {
+	return key > other.key;
+}
+
+inline bool DStarLiteSolver::repaired() const noexcept {
+	return m_repaired;
+}
+
+inline size_t DStarLiteSolver::frontierSize() const noexcept {
+	return m_openList.size();
+}
+
+inline bool DStarLiteSolver::reachedTarget() const noexcept {
+	return m_done;
+}
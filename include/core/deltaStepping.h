@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include "core/gridModel.h"
+#include "core/searchStats.h"
+#include "core/threadPool.h"
+
+// delta-stepping single-source shortest paths over GridModel::cost() on every core, the parallel counterpart of DijkstraSolver.
+// cells are kept in buckets of delta distance units. a bucket is emptied in phases that relax the light moves (cost <= delta)
+// of all its cells at once, which may refill it; once it stays empty the heavy moves of everything it settled are relaxed once.
+// distance and parent of a cell share one atomic word, distance in the high half, so a single compare-exchange min keeps the
+// pair consistent. distances equal DijkstraSolver's, parents are valid though ties may resolve to another neighbour
+class DeltaStepping {
+public:
+	constexpr static uint32_t defaultDelta = 32;
+
+	// threadCount counts the calling thread, 0 picks the hardware concurrency. delta is clamped to [1, GridModel::maximumCost]
+	explicit DeltaStepping(const GridModel & grid, size_t threadCount = 0, uint32_t delta = defaultDelta);
+	DeltaStepping(const DeltaStepping & other) = delete;
+	DeltaStepping(DeltaStepping && other) = delete;
+	DeltaStepping & operator=(const DeltaStepping & other) = delete;
+	DeltaStepping & operator=(DeltaStepping && other) = delete;
+
+	// settles cells until target is final, or every reachable cell when target is GridModel::npos.
+	// returns the distance of target, GridModel::npos if it is unreachable or was not given
+	[[nodiscard]]
+	uint32_t run(uint32_t source, uint32_t target = GridModel::npos) noexcept;
+	// of the last run, GridModel::npos for cells it did not reach. only final for cells settled before it stopped
+	[[nodiscard]]
+	uint32_t distance(uint32_t cell) const noexcept;
+	// of the last run, GridModel::npos for the source and cells it did not reach
+	[[nodiscard]]
+	uint32_t parent(uint32_t cell) const noexcept;
+	// source to cell along the parents of the last run, empty if cell was not reached
+	[[nodiscard]]
+	std::vector<uint32_t> path(uint32_t cell) const;
+	[[nodiscard]]
+	uint32_t delta() const noexcept;
+	[[nodiscard]]
+	size_t threadCount() const noexcept;
+	// of the last run: expanded counts light expansions, pushed the bucket insertions, stalePops the entries skipped
+	// because their cell had moved to a lower bucket or was already expanded at its distance
+	[[nodiscard]]
+	const SearchStats & stats() const noexcept;
+
+private:
+	struct alignas(64) Lane {
+		std::vector<std::vector<uint32_t>> buckets; // cyclic, bucket index modulo their count
+		std::vector<uint32_t> frontier;		    // cells of the phase being expanded, taken out of the current bucket
+		std::vector<uint32_t> settled;		    // cells expanded in the current bucket, for its heavy pass
+		std::atomic<size_t> cursor = 0;		    // of frontier or settled, below it is taken by the owner or a thief
+		SearchStats stats;
+	};
+
+	// calls pass(own lane, cells, begin, end) over chunks of the given list of every lane, on the pool when there are enough
+	template<typename Pass>
+	void forEachChunk(std::vector<uint32_t> Lane::*list, Pass && pass) noexcept;
+	// light moves of one phase of bucket
+	void expandLight(Lane & own, const std::vector<uint32_t> & cells, size_t begin, size_t end, uint64_t bucket) noexcept;
+	// heavy moves out of a settled bucket
+	void expandHeavy(Lane & own, const std::vector<uint32_t> & cells, size_t begin, size_t end) noexcept;
+	// lowers the distance of togo to distance through from, queueing it into its bucket if that was an improvement
+	void relax(Lane & own, uint32_t from, uint32_t togo, uint32_t distance) noexcept;
+	// empty buckets are skipped, noBucket once every lane is out of cells
+	[[nodiscard]]
+	uint64_t nextBucket(uint64_t bucket) const noexcept;
+	[[nodiscard]]
+	static uint64_t pack(uint32_t distance, uint32_t parent) noexcept;
+
+	///
+	constexpr static size_t chunkSize = 256;
+	constexpr static size_t parallelThreshold = 1024;
+	constexpr static uint64_t unreached = UINT64_MAX; // label of cells not reached, npos distance and npos parent
+	constexpr static uint64_t noBucket = UINT64_MAX;
+
+	const GridModel & m_grid;
+	uint32_t m_delta;
+	size_t m_bucketCount; // a move lands at most GridModel::maximumCost / delta + 1 buckets ahead of the current one
+	ThreadPool m_pool;
+	std::vector<Lane> m_lanes;
+	std::vector<std::atomic<uint64_t>> m_label;	 // distance << 32 | parent
+	std::vector<std::atomic<uint32_t>> m_expandedAt; // distance the cell was last expanded at, so duplicates are skipped
+	SearchStats m_stats;
+};
+
+inline uint32_t DeltaStepping::distance(const uint32_t cell) const noexcept {
+	return static_cast<uint32_t>(m_label[cell].load(std::memory_order_relaxed) >> 32);
+}
+
+inline uint32_t DeltaStepping::parent(const uint32_t cell) const noexcept {
+	return static_cast<uint32_t>(m_label[cell].load(std::memory_order_relaxed));
+}
+
+inline uint32_t DeltaStepping::delta() const noexcept {
+	return m_delta;
+}
+
+inline size_t DeltaStepping::threadCount() const noexcept {
+	return m_pool.size();
+}
+
+inline const SearchStats & DeltaStepping::stats() const noexcept {
+	return m_stats;
+}
+
+inline uint64_t DeltaStepping::pack(const uint32_t distance, const uint32_t parent) noexcept {
+	return static_cast<uint64_t>(distance) << 32 | parent;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include "core/searchSolver.h"
+
+// Dijkstra from the source over every reachable cell, kept between runs for a source that stays put while the target moves.
+// the field is keyed on the source and GridModel::version(): while both match, start() finds it complete and the run is a
+// single step that reads the path back along the parents, O(path length) for any target. otherwise the first run floods the
+// whole grid before reporting the target, so that one costs a full Dijkstra without early exit. costs are paid like Dijkstra
+class DistanceFieldSolver : public SearchSolver {
+public:
+	using SearchSolver::SearchSolver;
+
+	// whether the last start() found the field of an earlier run still valid
+	[[nodiscard]]
+	bool cached() const noexcept;
+	// from the source of the field, GridModel::npos for cells it does not reach or while it is being built
+	[[nodiscard]]
+	uint32_t distance(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	std::vector<uint32_t> path() const noexcept override;
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+	[[nodiscard]]
+	bool reachedTarget() const noexcept override;
+	[[nodiscard]]
+	uint32_t currentParent() const noexcept override;
+
+private:
+	BinaryHeapQueue m_priorityQueue;
+	std::vector<uint32_t> m_distance; // plain vectors, they have to outlive start()
+	std::vector<uint32_t> m_parent;
+	uint32_t m_fieldSource = GridModel::npos;
+	uint64_t m_fieldVersion = 0;
+	bool m_complete = false; // every reachable cell is settled
+	bool m_cached = false;
+	bool m_done = false; // the target was reported
+};
+
+inline bool DistanceFieldSolver::cached() const noexcept {
+	return m_cached;
+}
+
+inline uint32_t DistanceFieldSolver::distance(const uint32_t cell) const noexcept {
+	return m_complete ? m_distance[cell] : GridModel::npos;
+}
+
+inline size_t DistanceFieldSolver::frontierSize() const noexcept {
+	return m_priorityQueue.size();
+}
+
+inline bool DistanceFieldSolver::reachedTarget() const noexcept {
+	return m_done;
+}
+
+inline uint32_t DistanceFieldSolver::currentParent() const noexcept {
+	return m_parent[m_current];
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/gridModel.h"
+
+// grids on disk. the native .pvgrid format is a fixed header, the blocks packed 64 cells to a word and, only for grids with
+// costs, one cost byte per cell. every section starts 8 byte aligned, so a mapped file is copied into the model without any
+// parsing. native byte order like SearchTrace::write. MovingAI .map and .scen benchmark files are read as well. grids too
+// large for memory go to .pvtiles files, laid out by TiledStore and read through it in place
+
+// .pvgrid and .pvtiles files by their magic, anything else as a MovingAI map. a .pvtiles file is read into memory as a
+// whole, openTiledGrid keeps it on disk. nullptr if the file cannot be read or is malformed, a tile that cannot be mapped
+// included. the GUI opens grids here, so it holds even a tiled grid in memory: its editing, the state of every cell it
+// draws and the solvers it runs are per cell anyway, and only the bench searches grids out of core
+[[nodiscard]]
+std::unique_ptr<GridModel> loadGrid(const std::string & path) noexcept;
+// always .pvgrid, the cost section only when some cell costs more than GridModel::minimumCost
+[[nodiscard]]
+bool saveGrid(const GridModel & grid, const std::string & path) noexcept;
+// a read only grid over the tiles of a .pvtiles file, at most residentLimit of them mapped at a time. nullptr if the file
+// cannot be opened or is malformed
+[[nodiscard]]
+std::unique_ptr<GridModel> openTiledGrid(const std::string & path, size_t residentLimit = TiledStore::defaultResidentLimit) noexcept;
+// .pvtiles for openTiledGrid, written one tile at a time so a tiled grid can be copied without being read into memory.
+// false if the file cannot be written or grid is a tiled one that failed to map a tile
+[[nodiscard]]
+bool saveTiledGrid(const GridModel & grid, const std::string & path) noexcept;
+// the type / height / width / map header is optional, rows of '.', 'G' or 'S' are open and anything else is a block
+[[nodiscard]]
+std::unique_ptr<GridModel> loadMovingAiMap(const std::string & path) noexcept;
+// {source, target} of every experiment of a scenario for grid, x being the column and y the row. their optimal lengths
+// assume 8-connected moves and are dropped. false if the file is malformed or made for a map of other dimensions
+[[nodiscard]]
+bool loadMovingAiScenario(const std::string & path, const GridModel & grid, std::vector<std::pair<uint32_t, uint32_t>> & queries) noexcept;
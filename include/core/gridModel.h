@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include "core/tiledStore.h"
+
+// headless row-major grid of cells; knows nothing about Qt or rendering. the cells are owned buffers, or a TiledStore for
+// grids too large to keep in memory. reading a tiled grid moves its tile cache, so unlike an owned one it is not safe to
+// read from two threads at once, not even through const references. a copy reads through a store of its own
+class GridModel {
+public:
+	constexpr static uint32_t npos = UINT32_MAX;
+	constexpr static uint8_t minimumCost = 1; // entering a plain cell
+	constexpr static uint8_t maximumCost = UINT8_MAX;
+	constexpr static std::array<int32_t, 4> xCord{-1, 1, 0, 0};
+	constexpr static std::array<int32_t, 4> yCord{0, 0, 1, -1};
+
+	GridModel(uint32_t rowCnt, uint32_t colCnt);
+	// cells read in place from tiles, with the dimensions of the store. such a grid is read only and edits are ignored
+	explicit GridModel(std::shared_ptr<TiledStore> tiles);
+	// a tiled grid is copied as another TiledStore over the same file, so the copy can go to another thread
+	GridModel(const GridModel & other);
+	GridModel(GridModel && other) noexcept = default;
+	GridModel & operator=(const GridModel & other);
+	GridModel & operator=(GridModel && other) noexcept = default;
+
+	// at least two cells (source and target) and every index representable below npos
+	[[nodiscard]]
+	static bool validDimensions(uint32_t rowCnt, uint32_t colCnt) noexcept;
+
+	[[nodiscard]]
+	uint32_t rowCount() const noexcept;
+	[[nodiscard]]
+	uint32_t colCount() const noexcept;
+	[[nodiscard]]
+	uint32_t cellCount() const noexcept;
+	[[nodiscard]]
+	uint32_t index(uint32_t row, uint32_t col) const noexcept;
+	[[nodiscard]]
+	std::pair<uint32_t, uint32_t> getCord(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	bool validCordinate(ptrdiff_t row, ptrdiff_t col) const noexcept;
+	[[nodiscard]]
+	bool isBlock(uint32_t cell) const noexcept;
+	void setBlock(uint32_t cell, bool block) noexcept;
+	void clearBlocks() noexcept;
+	// price of stepping onto cell, minimumCost to maximumCost. weighted solvers add it per move, the others ignore it
+	[[nodiscard]]
+	uint8_t cost(uint32_t cell) const noexcept;
+	void setCost(uint32_t cell, uint8_t cost) noexcept;
+	void clearCosts() noexcept;
+	// every cell at once: blocks packed 64 to a word, row-major from the lowest bit, and one cost per cell.
+	// the bulk path of loaders, costs below minimumCost are raised to it
+	void assignBlocks(const uint64_t * words) noexcept;
+	void assignCosts(const uint8_t * costs) noexcept;
+	// nullptr unless the cells are read from tiles
+	[[nodiscard]]
+	const TiledStore * tiles() const noexcept;
+	// some tile could not be read, see TiledStore::failed(). never for grids in memory
+	[[nodiscard]]
+	bool failed() const noexcept;
+	// changes with every edit of blocks or costs and is never shared by two grids that differ, copies keep it. caches
+	// derived from the grid key on it
+	[[nodiscard]]
+	uint64_t version() const noexcept;
+
+	// calls fn(neighbour) for every in-bounds neighbour in xCord/yCord order, blocks included
+	template<typename Fn>
+	void forEachNeighbour(uint32_t cell, Fn && fn) const noexcept;
+	// appends the cells after from up to and including to, both on one row or one column of a grid colCnt cells wide.
+	// static so path owners without a model (recorded traces) can expand skipped runs as well
+	static void appendRun(std::vector<uint32_t> & cells, uint32_t from, uint32_t to, uint32_t colCnt) noexcept;
+
+private:
+	// drawn from one process wide counter, so no two histories of edits end on the same value
+	[[nodiscard]]
+	static uint64_t nextVersion() noexcept;
+
+	///
+	uint32_t m_rowCnt;
+	uint32_t m_colCnt;
+	std::vector<uint8_t> m_blocked;
+	std::vector<uint8_t> m_cost;
+	std::shared_ptr<TiledStore> m_tiles;
+	uint64_t m_version = nextVersion();
+};
+
+inline GridModel::GridModel(const uint32_t rowCnt, const uint32_t colCnt)
+    : m_rowCnt(rowCnt), m_colCnt(colCnt), m_blocked(static_cast<size_t>(rowCnt) * colCnt, 0),
+	m_cost(static_cast<size_t>(rowCnt) * colCnt, minimumCost) {
+}
+
+inline GridModel::GridModel(std::shared_ptr<TiledStore> tiles)
+    : m_rowCnt(tiles->rowCount()), m_colCnt(tiles->colCount()), m_tiles(std::move(tiles)) {
+}
+
+inline GridModel::GridModel(const GridModel & other)
+    : m_rowCnt(other.m_rowCnt), m_colCnt(other.m_colCnt), m_blocked(other.m_blocked), m_cost(other.m_cost),
+	m_tiles(other.m_tiles ? other.m_tiles->copy() : nullptr), m_version(other.m_version) {
+}
+
+inline GridModel & GridModel::operator=(const GridModel & other) {
+	// member by member, the buffers of an owned grid keep their capacity
+	m_rowCnt = other.m_rowCnt;
+	m_colCnt = other.m_colCnt;
+	m_blocked = other.m_blocked;
+	m_cost = other.m_cost;
+	m_tiles = other.m_tiles ? other.m_tiles->copy() : nullptr;
+	m_version = other.m_version;
+	return *this;
+}
+
+inline bool GridModel::validDimensions(const uint32_t rowCnt, const uint32_t colCnt) noexcept {
+	const auto cellCnt = static_cast<uint64_t>(rowCnt) * colCnt;
+	return rowCnt && colCnt && cellCnt >= 2 && cellCnt < npos;
+}
+
+inline uint32_t GridModel::rowCount() const noexcept {
+	return m_rowCnt;
+}
+
+inline uint32_t GridModel::colCount() const noexcept {
+	return m_colCnt;
+}
+
+inline uint32_t GridModel::cellCount() const noexcept {
+	return m_rowCnt * m_colCnt;
+}
+
+inline uint32_t GridModel::index(const uint32_t row, const uint32_t col) const noexcept {
+	return row * m_colCnt + col;
+}
+
+inline std::pair<uint32_t, uint32_t> GridModel::getCord(const uint32_t cell) const noexcept {
+	return {cell / m_colCnt, cell % m_colCnt};
+}
+
+inline bool GridModel::validCordinate(const ptrdiff_t row, const ptrdiff_t col) const noexcept {
+	return row >= 0 && static_cast<size_t>(row) < m_rowCnt && col >= 0 && static_cast<size_t>(col) < m_colCnt;
+}
+
+inline bool GridModel::isBlock(const uint32_t cell) const noexcept {
+	if(__builtin_expect(m_tiles != nullptr, 0)) {
+		return m_tiles->isBlock(cell);
+	}
+
+	return m_blocked[cell];
+}
+
+inline void GridModel::setBlock(const uint32_t cell, const bool block) noexcept {
+	if(!m_tiles && m_blocked[cell] != block) {
+		m_blocked[cell] = block;
+		m_version = nextVersion();
+	}
+}
+
+inline void GridModel::clearBlocks() noexcept {
+	if(m_tiles) {
+		return;
+	}
+
+	m_blocked.assign(m_blocked.size(), 0);
+	m_version = nextVersion();
+}
+
+inline uint8_t GridModel::cost(const uint32_t cell) const noexcept {
+	if(__builtin_expect(m_tiles != nullptr, 0)) {
+		return m_tiles->cost(cell);
+	}
+
+	return m_cost[cell];
+}
+
+inline void GridModel::setCost(const uint32_t cell, const uint8_t cost) noexcept {
+	if(const uint8_t clamped = std::max(cost, minimumCost); !m_tiles && m_cost[cell] != clamped) {
+		m_cost[cell] = clamped;
+		m_version = nextVersion();
+	}
+}
+
+inline void GridModel::clearCosts() noexcept {
+	if(m_tiles) {
+		return;
+	}
+
+	m_cost.assign(m_cost.size(), minimumCost);
+	m_version = nextVersion();
+}
+
+inline void GridModel::assignBlocks(const uint64_t * const words) noexcept {
+	if(m_tiles) {
+		return;
+	}
+
+	for(size_t cell = 0; cell < m_blocked.size(); cell++) {
+		m_blocked[cell] = words[cell / 64] >> cell % 64 & 1;
+	}
+
+	m_version = nextVersion();
+}
+
+inline void GridModel::assignCosts(const uint8_t * const costs) noexcept {
+	if(m_tiles) {
+		return;
+	}
+
+	std::transform(costs, costs + m_cost.size(), m_cost.begin(), [](const uint8_t cost) { return std::max(cost, minimumCost); });
+	m_version = nextVersion();
+}
+
+inline const TiledStore * GridModel::tiles() const noexcept {
+	return m_tiles.get();
+}
+
+inline bool GridModel::failed() const noexcept {
+	return m_tiles && m_tiles->failed();
+}
+
+inline uint64_t GridModel::version() const noexcept {
+	return m_version;
+}
+
+inline uint64_t GridModel::nextVersion() noexcept {
+	static std::atomic<uint64_t> counter = 0;
+	return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+template<typename Fn>
+void GridModel::forEachNeighbour(const uint32_t cell, Fn && fn) const noexcept {
+	const auto [curX, curY] = getCord(cell);
+
+	for(uint32_t direction = 0; direction < 4; direction++) {
+		const auto toRow = static_cast<ptrdiff_t>(curX) + xCord[direction];
+		const auto toCol = static_cast<ptrdiff_t>(curY) + yCord[direction];
+
+		if(validCordinate(toRow, toCol)) {
+			fn(index(static_cast<uint32_t>(toRow), static_cast<uint32_t>(toCol)));
+		}
+	}
+}
+
+inline void GridModel::appendRun(std::vector<uint32_t> & cells, const uint32_t from, const uint32_t to, const uint32_t colCnt) noexcept {
+	const uint32_t stride = from / colCnt == to / colCnt ? 1 : colCnt;
+
+	if(from < to) {
+		for(uint32_t cell = from + stride; cell <= to; cell += stride) {
+			cells.push_back(cell);
+		}
+	} else {
+		for(uint32_t cell = from; cell != to;) {
+			cell -= stride;
+			cells.push_back(cell);
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include "core/gridModel.h"
+
+// admissible distance estimates for informed searches. moves are 4-connected and cost at least GridModel::minimumCost,
+// so Manhattan is the tightest of them and the rest trade expansions for generality
+enum class Heuristic : uint8_t {
+	Manhattan,
+	Octile,
+	Euclidean,
+	Zero
+};
+
+constexpr uint8_t heuristicCount = 4;
+
+// rounded down, a fractional estimate never overshoots the integral cost of a path
+[[nodiscard]]
+inline uint32_t estimateDistance(const Heuristic heuristic, const GridModel & grid, const uint32_t from, const uint32_t to) noexcept {
+	const auto [fromRow, fromCol] = grid.getCord(from);
+	const auto [toRow, toCol] = grid.getCord(to);
+	const uint32_t rowDelta = fromRow > toRow ? fromRow - toRow : toRow - fromRow;
+	const uint32_t colDelta = fromCol > toCol ? fromCol - toCol : toCol - fromCol;
+
+	switch(heuristic) {
+	case Heuristic::Manhattan:
+		return rowDelta + colDelta;
+	case Heuristic::Octile: {
+		constexpr double diagonalExtra = 0.41421356237309515; // sqrt(2) - 1
+		return std::max(rowDelta, colDelta) + static_cast<uint32_t>(diagonalExtra * std::min(rowDelta, colDelta));
+	}
+	case Heuristic::Euclidean:
+		return static_cast<uint32_t>(std::sqrt(static_cast<double>(rowDelta) * rowDelta + static_cast<double>(colDelta) * colDelta));
+	case Heuristic::Zero:
+		return 0;
+	default:
+		__builtin_unreachable();
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <utility>
+#include "core/searchSolver.h"
+
+// hierarchical A* (HPA*) for many queries on a mostly static grid. the grid is cut into square clusters; every run of open
+// cell pairs across a cluster border gets one or two entrances, and the cost between any two entrances of a cluster is
+// precomputed. a query links source and target into that abstract graph with one local search each and runs A* over it, so
+// its cost follows the entrance count rather than the cell count. expansions are abstract nodes, path() refines them back
+// into cells. paths pay GridModel::cost() and are near optimal: the route is bound to pass the borders at entrances.
+// edits are reported through invalidate(), the next start() rebuilds only the clusters they touched and their neighbours
+class HpaSolver : public AStarSolver {
+	struct Node {
+		uint32_t cell;
+		std::array<uint32_t, 4> across{GridModel::npos, GridModel::npos, GridModel::npos, GridModel::npos}; // entrances over borders
+	};
+
+	struct Cluster {
+		uint32_t rowBegin;
+		uint32_t rowEnd;
+		uint32_t colBegin;
+		uint32_t colEnd;
+		std::vector<Node> nodes;
+		std::vector<uint32_t> distance; // nodes.size() squared, row i holds the costs from node i, UINT32_MAX if unreachable
+	};
+
+public:
+	constexpr static uint32_t defaultClusterSize = 16;
+
+	explicit HpaSolver(const GridModel & grid, uint32_t clusterSize = defaultClusterSize);
+
+	// cell changed its block or cost since the last start(). a resized grid is noticed without being reported
+	void invalidate(uint32_t cell) noexcept;
+	void invalidateAll() noexcept;
+	// clusters rebuilt over the lifetime of the solver, neighbours of edited ones included
+	[[nodiscard]]
+	uint64_t rebuiltClusters() const noexcept;
+	[[nodiscard]]
+	std::vector<uint32_t> path() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+
+private:
+	// (re)cuts the grid into clusters when its dimensions changed, then rebuilds every dirty cluster and its neighbours
+	void refresh() noexcept;
+	// entrances of the border east (vertical) or south of cluster
+	void buildBorder(uint32_t cluster, bool vertical) noexcept;
+	// nodes from the four borders around cluster, then one local search per node for the distance table
+	void buildCluster(uint32_t cluster) noexcept;
+	// Dijkstra bound to the cells of cluster from cell into m_localDistance / m_localParent. reverse computes the costs to cell
+	void localSearch(const Cluster & cluster, uint32_t cell, bool reverse) noexcept;
+	// cells after from up to and including to along the local parents of a forward localSearch from from
+	void appendLocalPath(const Cluster & cluster, uint32_t from, uint32_t to, std::vector<uint32_t> & cells) noexcept;
+	// abstract parents from m_target back to m_source, refined into m_path
+	void refinePath() noexcept;
+	[[nodiscard]]
+	uint32_t clusterOf(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	uint32_t localIndex(const Cluster & cluster, uint32_t cell) const noexcept;
+	[[nodiscard]]
+	uint32_t borderIndex(uint32_t cluster, bool vertical) const noexcept;
+
+	///
+	constexpr static uint32_t splitRun = 6; // border runs at least this long get an entrance at both ends instead of the middle
+
+	uint32_t m_clusterSize;
+	uint32_t m_rowCnt = 0; // dimensions the clusters were cut for
+	uint32_t m_colCnt = 0;
+	uint32_t m_clusterRows = 0;
+	uint32_t m_clusterCols = 0;
+	std::vector<Cluster> m_clusters;
+	std::vector<std::vector<std::pair<uint32_t, uint32_t>>> m_borders; // two per cluster, {cell inside, cell in the neighbour}
+	std::vector<uint32_t> m_slot;					    // node index of every entrance cell in its cluster, npos elsewhere
+	std::vector<uint8_t> m_dirty;
+	std::vector<uint32_t> m_dirtyList;
+	bool m_allDirty = true;
+	uint64_t m_rebuilt = 0;
+
+	// query state
+	std::vector<std::pair<uint32_t, uint32_t>> m_sourceLinks; // {cell, cost} of the local search from the source
+	std::vector<uint32_t> m_targetCosts;			  // per node of the target cluster, cost on to the target
+	std::vector<uint32_t> m_path;
+
+	// local search scratch, one cluster large
+	BinaryHeapQueue m_localQueue;
+	std::vector<uint32_t> m_localDistance;
+	std::vector<uint32_t> m_localParent;
+};
+
+inline uint64_t HpaSolver::rebuiltClusters() const noexcept {
+	return m_rebuilt;
+}
+
+inline uint32_t HpaSolver::clusterOf(const uint32_t cell) const noexcept {
+	const auto [row, col] = m_grid.getCord(cell);
+	return row / m_clusterSize * m_clusterCols + col / m_clusterSize;
+}
+
+inline uint32_t HpaSolver::localIndex(const Cluster & cluster, const uint32_t cell) const noexcept {
+	const auto [row, col] = m_grid.getCord(cell);
+	return (row - cluster.rowBegin) * (cluster.colEnd - cluster.colBegin) + col - cluster.colBegin;
+}
+
+inline uint32_t HpaSolver::borderIndex(const uint32_t cluster, const bool vertical) const noexcept {
+	return cluster * 2 + vertical;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// read only mapping of a whole file, unmapped again by close() or the destructor. pages are read in on first touch
+class MappedFile {
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile & other) = delete;
+	MappedFile(MappedFile && other) = delete;
+	MappedFile & operator=(const MappedFile & other) = delete;
+	MappedFile & operator=(MappedFile && other) = delete;
+	~MappedFile();
+
+	// false if the file cannot be opened, is empty or cannot be mapped. an earlier mapping is closed first
+	[[nodiscard]]
+	bool open(const std::string & path) noexcept;
+	void close() noexcept;
+	// page aligned, nullptr while nothing is mapped
+	[[nodiscard]]
+	const uint8_t * data() const noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+
+private:
+	const uint8_t * m_data = nullptr;
+	size_t m_size = 0;
+};
+
+inline MappedFile::~MappedFile() {
+	close();
+}
+
+inline const uint8_t * MappedFile::data() const noexcept {
+	return m_data;
+}
+
+inline size_t MappedFile::size() const noexcept {
+	return m_size;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include "core/gridModel.h"
+#include "core/searchStats.h"
+#include "core/threadPool.h"
+
+// level-synchronous BFS over every core for very large grids, costs ignored. each thread appends what it discovers to its own
+// frontier; the next level starts on that frontier and then steals chunks of the others, so no level is merged serially.
+// a cell belongs to whoever sets its visited bit first, and only that thread writes its parent and distance.
+// distances match BfsSolver, parents are valid shortest-path parents though ties may resolve to another neighbour
+class ParallelBfs {
+public:
+	// threadCount counts the calling thread, 0 picks the hardware concurrency
+	explicit ParallelBfs(const GridModel & grid, size_t threadCount = 0);
+	ParallelBfs(const ParallelBfs & other) = delete;
+	ParallelBfs(ParallelBfs && other) = delete;
+	ParallelBfs & operator=(const ParallelBfs & other) = delete;
+	ParallelBfs & operator=(ParallelBfs && other) = delete;
+
+	// searches until target is reached, or floods every reachable cell when target is GridModel::npos.
+	// returns the distance of target, GridModel::npos if it is unreachable or was not given. blocks are read as they are
+	[[nodiscard]]
+	uint32_t run(uint32_t source, uint32_t target = GridModel::npos) noexcept;
+	// of the last run, GridModel::npos for cells it did not reach
+	[[nodiscard]]
+	uint32_t distance(uint32_t cell) const noexcept;
+	// of the last run, GridModel::npos for the source and cells it did not reach
+	[[nodiscard]]
+	uint32_t parent(uint32_t cell) const noexcept;
+	// source to cell along the parents of the last run, empty if cell was not reached
+	[[nodiscard]]
+	std::vector<uint32_t> path(uint32_t cell) const;
+	[[nodiscard]]
+	size_t threadCount() const noexcept;
+	// of the last run: expanded counts the cells whose neighbours were scanned, pushed the cells reached
+	[[nodiscard]]
+	const SearchStats & stats() const noexcept;
+
+private:
+	struct alignas(64) Lane {
+		std::vector<uint32_t> frontier;
+		std::vector<uint32_t> next;
+		std::atomic<size_t> cursor = 0; // frontier below it is taken, by the owner or a thief
+		uint64_t expanded = 0;
+	};
+
+	// expands chunks of every frontier into the next one of lane index, its own frontier first
+	void expandLevel(size_t index, uint32_t level, uint32_t target) noexcept;
+	// sets the visited bit of cell, true if this call was the one setting it
+	bool claim(uint32_t cell) noexcept;
+	[[nodiscard]]
+	bool visited(uint32_t cell) const noexcept;
+
+	///
+	constexpr static size_t wordBits = 64;
+	constexpr static size_t chunkSize = 256;	    // frontier cells taken per steal
+	constexpr static size_t parallelThreshold = 2048; // smaller levels are cheaper to expand on the calling thread alone
+
+	const GridModel & m_grid;
+	ThreadPool m_pool;
+	std::vector<Lane> m_lanes;
+	std::vector<std::atomic<uint64_t>> m_visited;
+	std::vector<uint32_t> m_parent;
+	std::vector<uint32_t> m_distance;
+	std::atomic<bool> m_found = false;
+	SearchStats m_stats;
+};
+
+inline uint32_t ParallelBfs::distance(const uint32_t cell) const noexcept {
+	return visited(cell) ? m_distance[cell] : GridModel::npos;
+}
+
+inline uint32_t ParallelBfs::parent(const uint32_t cell) const noexcept {
+	return visited(cell) ? m_parent[cell] : GridModel::npos;
+}
+
+inline size_t ParallelBfs::threadCount() const noexcept {
+	return m_pool.size();
+}
+
+inline const SearchStats & ParallelBfs::stats() const noexcept {
+	return m_stats;
+}
+
+inline bool ParallelBfs::visited(const uint32_t cell) const noexcept {
+	return m_visited[cell / wordBits].load(std::memory_order_relaxed) >> (cell % wordBits) & 1;
+}
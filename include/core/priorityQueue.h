@@ -0,0 +1,320 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include "core/gridModel.h"
+#include "core/stampedBuffer.h"
+
+// min priority queues of {key, cell} for Dijkstra, all with the same shape:
+//   reset(cellCount), push(key, cell), empty(), pop() -> {key, cell}, size()
+// keys are distances so every push is >= the last pop, which the bucket based queues rely on.
+// lazy queues keep stale entries when a cell is pushed again, callers skip those by comparing against their distance
+enum class QueueBackend : uint8_t {
+	BinaryHeap, // std::push_heap / std::pop_heap, lazy
+	DaryHeap,   // 4-ary heap with decrease-key, at most one entry per cell
+	Dial,	    // circular buckets, one per distance within GridModel::maximumCost, lazy
+	Radix	    // 33 buckets by highest bit differing from the last pop, lazy
+};
+
+constexpr uint8_t queueBackendCount = 4;
+
+class BinaryHeapQueue {
+public:
+	void reset(size_t cellCount) noexcept;
+	void push(uint32_t key, uint32_t cell) noexcept;
+	[[nodiscard]]
+	bool empty() const noexcept;
+	[[nodiscard]]
+	std::pair<uint32_t, uint32_t> pop() noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+
+private:
+	std::vector<std::pair<uint32_t, uint32_t>> m_heap;
+};
+
+// push() of a queued cell lowers its key in place, so stale entries never exist
+template<uint32_t arity>
+class DaryHeapQueue {
+	static_assert(arity >= 2);
+
+public:
+	void reset(size_t cellCount) noexcept;
+	void push(uint32_t key, uint32_t cell) noexcept;
+	[[nodiscard]]
+	bool empty() const noexcept;
+	[[nodiscard]]
+	std::pair<uint32_t, uint32_t> pop() noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+
+private:
+	void siftUp(size_t slot) noexcept;
+	void siftDown(size_t slot) noexcept;
+	void place(size_t slot, std::pair<uint32_t, uint32_t> entry) noexcept;
+
+	///
+	std::vector<std::pair<uint32_t, uint32_t>> m_heap;
+	StampedBuffer<uint32_t> m_slot{GridModel::npos}; // heap slot of every queued cell
+};
+
+// Dial's buckets, O(1) push and amortised O(maxCost) pop for edge costs up to maxCost
+class DialQueue {
+public:
+	explicit DialQueue(uint32_t maxCost = GridModel::maximumCost);
+
+	void reset(size_t cellCount) noexcept;
+	void push(uint32_t key, uint32_t cell) noexcept;
+	[[nodiscard]]
+	bool empty() const noexcept;
+	[[nodiscard]]
+	std::pair<uint32_t, uint32_t> pop() noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+
+private:
+	std::vector<std::vector<uint32_t>> m_buckets; // key % bucket count, live keys span at most maxCost + 1 values
+	uint32_t m_currentKey = 0;
+	size_t m_size = 0;
+};
+
+// radix heap for monotone keys: an entry moves down at most 32 buckets over its lifetime
+class RadixHeapQueue {
+public:
+	void reset(size_t cellCount) noexcept;
+	void push(uint32_t key, uint32_t cell) noexcept;
+	[[nodiscard]]
+	bool empty() const noexcept;
+	[[nodiscard]]
+	std::pair<uint32_t, uint32_t> pop() noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+
+private:
+	[[nodiscard]]
+	size_t bucketOf(uint32_t key) const noexcept;
+
+	///
+	std::array<std::vector<std::pair<uint32_t, uint32_t>>, 33> m_buckets;
+	uint32_t m_lastKey = 0;
+	size_t m_size = 0;
+};
+
+inline void BinaryHeapQueue::reset(size_t) noexcept {
+	m_heap.clear();
+}
+
+inline void BinaryHeapQueue::push(const uint32_t key, const uint32_t cell) noexcept {
+	m_heap.push_back({key, cell});
+	std::push_heap(m_heap.begin(), m_heap.end(), std::greater<>());
+}
+
+inline bool BinaryHeapQueue::empty() const noexcept {
+	return m_heap.empty();
+}
+
+inline std::pair<uint32_t, uint32_t> BinaryHeapQueue::pop() noexcept {
+	std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<>());
+	const auto entry = m_heap.back();
+	m_heap.pop_back();
+	return entry;
+}
+
+inline size_t BinaryHeapQueue::size() const noexcept {
+	return m_heap.size();
+}
+
+template<uint32_t arity>
+void DaryHeapQueue<arity>::reset(const size_t cellCount) noexcept {
+	m_heap.clear();
+	m_slot.resize(cellCount);
+}
+
+template<uint32_t arity>
+void DaryHeapQueue<arity>::push(const uint32_t key, const uint32_t cell) noexcept {
+	const uint32_t slot = m_slot.get(cell);
+
+	if(slot == GridModel::npos) {
+		m_heap.push_back({key, cell});
+		m_slot.set(cell, static_cast<uint32_t>(m_heap.size() - 1));
+		siftUp(m_heap.size() - 1);
+	} else if(key < m_heap[slot].first) {
+		m_heap[slot].first = key;
+		siftUp(slot);
+	}
+}
+
+template<uint32_t arity>
+bool DaryHeapQueue<arity>::empty() const noexcept {
+	return m_heap.empty();
+}
+
+template<uint32_t arity>
+std::pair<uint32_t, uint32_t> DaryHeapQueue<arity>::pop() noexcept {
+	const auto top = m_heap.front();
+	m_slot.set(top.second, GridModel::npos);
+
+	const auto last = m_heap.back();
+	m_heap.pop_back();
+
+	if(!m_heap.empty()) {
+		place(0, last);
+		siftDown(0);
+	}
+
+	return top;
+}
+
+template<uint32_t arity>
+size_t DaryHeapQueue<arity>::size() const noexcept {
+	return m_heap.size();
+}
+
+template<uint32_t arity>
+void DaryHeapQueue<arity>::place(const size_t slot, const std::pair<uint32_t, uint32_t> entry) noexcept {
+	m_heap[slot] = entry;
+	m_slot.set(entry.second, static_cast<uint32_t>(slot));
+}
+
+template<uint32_t arity>
+void DaryHeapQueue<arity>::siftUp(size_t slot) noexcept {
+	const auto entry = m_heap[slot];
+
+	while(slot) {
+		const size_t parent = (slot - 1) / arity;
+
+		if(m_heap[parent].first <= entry.first) {
+			break;
+		}
+
+		place(slot, m_heap[parent]);
+		slot = parent;
+	}
+
+	place(slot, entry);
+}
+
+template<uint32_t arity>
+void DaryHeapQueue<arity>::siftDown(size_t slot) noexcept {
+	const auto entry = m_heap[slot];
+
+	for(;;) {
+		const size_t firstChild = slot * arity + 1;
+
+		if(firstChild >= m_heap.size()) {
+			break;
+		}
+
+		const size_t lastChild = std::min(firstChild + arity, m_heap.size());
+		size_t best = firstChild;
+
+		for(size_t child = firstChild + 1; child < lastChild; child++) {
+			if(m_heap[child].first < m_heap[best].first) {
+				best = child;
+			}
+		}
+
+		if(entry.first <= m_heap[best].first) {
+			break;
+		}
+
+		place(slot, m_heap[best]);
+		slot = best;
+	}
+
+	place(slot, entry);
+}
+
+inline DialQueue::DialQueue(const uint32_t maxCost) : m_buckets(static_cast<size_t>(maxCost) + 1) {
+}
+
+inline void DialQueue::reset(size_t) noexcept {
+	for(auto & bucket : m_buckets) {
+		bucket.clear();
+	}
+
+	m_currentKey = 0;
+	m_size = 0;
+}
+
+inline void DialQueue::push(const uint32_t key, const uint32_t cell) noexcept {
+	m_buckets[key % m_buckets.size()].push_back(cell);
+	m_size++;
+}
+
+inline bool DialQueue::empty() const noexcept {
+	return !m_size;
+}
+
+inline std::pair<uint32_t, uint32_t> DialQueue::pop() noexcept {
+	// callers never pop an empty queue, so a non empty bucket lies at most maxCost keys ahead
+	while(m_buckets[m_currentKey % m_buckets.size()].empty()) {
+		m_currentKey++;
+	}
+
+	auto & bucket = m_buckets[m_currentKey % m_buckets.size()];
+	const uint32_t cell = bucket.back();
+	bucket.pop_back();
+	m_size--;
+	return {m_currentKey, cell};
+}
+
+inline size_t DialQueue::size() const noexcept {
+	return m_size;
+}
+
+inline void RadixHeapQueue::reset(size_t) noexcept {
+	for(auto & bucket : m_buckets) {
+		bucket.clear();
+	}
+
+	m_lastKey = 0;
+	m_size = 0;
+}
+
+inline size_t RadixHeapQueue::bucketOf(const uint32_t key) const noexcept {
+	return key == m_lastKey ? 0 : static_cast<size_t>(32 - __builtin_clz(key ^ m_lastKey));
+}
+
+inline void RadixHeapQueue::push(const uint32_t key, const uint32_t cell) noexcept {
+	m_buckets[bucketOf(key)].push_back({key, cell});
+	m_size++;
+}
+
+inline bool RadixHeapQueue::empty() const noexcept {
+	return !m_size;
+}
+
+inline std::pair<uint32_t, uint32_t> RadixHeapQueue::pop() noexcept {
+	if(m_buckets[0].empty()) {
+		size_t index = 1;
+
+		while(m_buckets[index].empty()) {
+			index++;
+		}
+
+		// the smallest key of the first non empty bucket becomes the new reference, every entry lands in a lower bucket
+		auto & bucket = m_buckets[index];
+		m_lastKey = std::min_element(bucket.begin(), bucket.end())->first;
+
+		for(const auto & entry : bucket) {
+			m_buckets[bucketOf(entry.first)].push_back(entry);
+		}
+
+		bucket.clear();
+	}
+
+	const auto entry = m_buckets[0].back();
+	m_buckets[0].pop_back();
+	m_size--;
+	return entry;
+}
+
+inline size_t RadixHeapQueue::size() const noexcept {
+	return m_size;
+}
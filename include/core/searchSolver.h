@@ -0,0 +1,402 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <functional>
+#include <memory>
+#include "core/gridModel.h"
+#include "core/stampedBuffer.h"
+#include "core/searchTrace.h"
+#include "core/searchStats.h"
+#include "core/heuristic.h"
+#include "core/priorityQueue.h"
+
+class ComponentIndex;
+
+// stepwise single-pair search over a GridModel. one step() == one node expansion
+// solvers are meant to be reused: start() only bumps buffer generations and keeps frontier capacity
+// the Dijkstra and A* families pay GridModel::cost() per move, BFS, DFS and JPS count moves and ignore it
+class SearchSolver {
+public:
+	enum class Status {
+		Idle,
+		Running,
+		Found,
+		Exhausted,
+		Failed // a tiled grid could not read some cells, nothing is known about the pair, see GridModel::failed()
+	};
+
+	explicit SearchSolver(const GridModel & grid);
+	SearchSolver(const SearchSolver & other) = delete;
+	SearchSolver(SearchSolver && other) = delete;
+	SearchSolver & operator=(const SearchSolver & other) = delete;
+	SearchSolver & operator=(SearchSolver && other) = delete;
+	virtual ~SearchSolver() = default;
+
+	void start(uint32_t source, uint32_t target) noexcept;
+	Status step() noexcept;
+	Status run() noexcept;
+	[[nodiscard]]
+	Status status() const noexcept;
+	[[nodiscard]]
+	uint32_t current() const noexcept;
+	[[nodiscard]]
+	uint32_t currentDistance() const noexcept;
+	[[nodiscard]]
+	uint32_t pathParent(uint32_t cell) const noexcept;
+	// entries waiting in the frontier, stale ones of lazy queues included
+	[[nodiscard]]
+	virtual size_t frontierSize() const noexcept = 0;
+	// counters of the search since start(), solverSeconds is left to the caller
+	[[nodiscard]]
+	const SearchStats & stats() const noexcept;
+	// source first, target last. empty unless status() == Found
+	[[nodiscard]]
+	virtual std::vector<uint32_t> path() const noexcept;
+	// every following push and pop is appended to trace until it is reset to nullptr. start() begins the log
+	void setTrace(TraceRecorder * trace) noexcept;
+	// start() ends queries between two components of the index as Exhausted before expanding anything, until it is reset
+	// to nullptr. the index has to be refreshed for the grid the solver searches
+	void setComponents(ComponentIndex * components) noexcept;
+
+protected:
+	// seed the frontier with m_source
+	virtual void reset() noexcept = 0;
+	// pop and expand one node, setting m_current and m_currentDistance. false once the frontier is empty
+	[[nodiscard]]
+	virtual bool expand() noexcept = 0;
+	// solvers call this for every frontier insertion, the seed included
+	void recordPush(uint32_t cell) noexcept;
+	// checked after every expansion
+	[[nodiscard]]
+	virtual bool reachedTarget() const noexcept;
+	// tree parent of m_current, as recorded in traces
+	[[nodiscard]]
+	virtual uint32_t currentParent() const noexcept;
+
+	///
+	const GridModel & m_grid;
+	StampedBuffer<uint32_t> m_pathParent{GridModel::npos};
+	uint32_t m_source = GridModel::npos;
+	uint32_t m_target = GridModel::npos;
+	uint32_t m_current = GridModel::npos;
+	uint32_t m_currentDistance = 0;
+	SearchStats m_stats;
+	Status m_status = Status::Idle;
+	TraceRecorder * m_trace = nullptr;
+	ComponentIndex * m_components = nullptr;
+};
+
+class BfsSolver : public SearchSolver {
+public:
+	using SearchSolver::SearchSolver;
+
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+
+private:
+	std::vector<std::pair<uint32_t, uint32_t>> m_queue; // {cell, distance}, popped from m_queueHead
+	size_t m_queueHead = 0;
+	StampedSet m_visited;
+};
+
+class DfsSolver : public SearchSolver {
+public:
+	using SearchSolver::SearchSolver;
+
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+
+private:
+	std::vector<std::pair<uint32_t, uint32_t>> m_stack; // {cell, distance}
+	StampedSet m_visited;
+};
+
+// Dijkstra over any queue of priorityQueue.h. lazy queues may hand back stale entries, those are skipped against m_distance
+template<typename Queue>
+class BasicDijkstraSolver : public SearchSolver {
+public:
+	explicit BasicDijkstraSolver(const GridModel & grid, Queue queue = Queue{});
+
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+
+private:
+	Queue m_priorityQueue;
+	StampedBuffer<uint32_t> m_distance{UINT32_MAX};
+};
+
+using DijkstraSolver = BasicDijkstraSolver<BinaryHeapQueue>;
+
+// the Dijkstra solver running on backend
+[[nodiscard]]
+std::unique_ptr<SearchSolver> makeDijkstraSolver(const GridModel & grid, QueueBackend backend);
+
+// BFS from both ends at once, one level of the smaller frontier per turn. the level that first connects the two trees
+// is still finished before stopping, so the stitched path is as short as the one a one way BFS finds
+class BidirectionalBfsSolver : public SearchSolver {
+	struct Frontier {
+		std::vector<uint32_t> queue; // popped from head, the level in progress ends at levelEnd
+		size_t head = 0;
+		size_t levelEnd = 0;
+		StampedBuffer<uint32_t> depth{GridModel::npos};
+	};
+
+public:
+	using SearchSolver::SearchSolver;
+
+	[[nodiscard]]
+	std::vector<uint32_t> path() const noexcept override;
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+	[[nodiscard]]
+	bool reachedTarget() const noexcept override;
+	[[nodiscard]]
+	uint32_t currentParent() const noexcept override;
+
+private:
+	std::array<Frontier, 2> m_frontiers; // from the source, from the target
+	StampedBuffer<uint32_t> m_backwardParent{GridModel::npos};
+	size_t m_side = 0; // frontier m_current was popped from
+	bool m_levelOpen = false;
+	uint32_t m_bestLength = GridModel::npos;
+	uint32_t m_meetForward = GridModel::npos;  // adjacent pair joining the trees, on the source side
+	uint32_t m_meetBackward = GridModel::npos; // and on the target side
+	bool m_met = false;
+};
+
+// Dijkstra from both ends, always growing the smaller heap. stops once the two heap tops together
+// cannot beat the best route seen crossing between the trees
+class BidirectionalDijkstraSolver : public SearchSolver {
+	using pIntCell = std::pair<uint32_t, uint32_t>; // {distance, cell}
+
+	struct Frontier {
+		std::vector<pIntCell> heap; // min-heap through std::push_heap / std::pop_heap
+		StampedBuffer<uint32_t> distance{UINT32_MAX};
+	};
+
+public:
+	using SearchSolver::SearchSolver;
+
+	[[nodiscard]]
+	std::vector<uint32_t> path() const noexcept override;
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+	[[nodiscard]]
+	bool reachedTarget() const noexcept override;
+	[[nodiscard]]
+	uint32_t currentParent() const noexcept override;
+
+private:
+	// drops lazily deleted entries off the top, the top distance or UINT32_MAX when empty
+	[[nodiscard]]
+	uint32_t liveTop(Frontier & frontier) noexcept;
+
+	///
+	std::array<Frontier, 2> m_frontiers; // from the source, from the target
+	StampedBuffer<uint32_t> m_backwardParent{GridModel::npos};
+	size_t m_side = 0;
+	uint32_t m_bestLength = UINT32_MAX;
+	uint32_t m_meetForward = GridModel::npos;
+	uint32_t m_meetBackward = GridModel::npos;
+	bool m_met = false;
+};
+
+// Dijkstra ordered by distance + estimate to the target. ties go to the entry closest to the target
+class AStarSolver : public SearchSolver {
+	struct Entry {
+		uint32_t priority; // distance + estimate
+		uint32_t estimate;
+		uint32_t cell;
+
+		[[nodiscard]]
+		bool operator>(const Entry & other) const noexcept;
+	};
+
+public:
+	using SearchSolver::SearchSolver;
+
+	// takes effect on the next start()
+	void setHeuristic(Heuristic heuristic) noexcept;
+	[[nodiscard]]
+	Heuristic heuristic() const noexcept;
+	[[nodiscard]]
+	size_t frontierSize() const noexcept override;
+
+protected:
+	void reset() noexcept override;
+	[[nodiscard]]
+	bool expand() noexcept override;
+	// pops the best live entry into m_current and m_currentDistance, false once the open list is empty
+	[[nodiscard]]
+	bool popOpen() noexcept;
+	// opens cell at distance through parent unless it is already known by a route at least as short
+	void relax(uint32_t cell, uint32_t distance, uint32_t parent) noexcept;
+
+private:
+	std::vector<Entry> m_openList; // min-heap through std::push_heap / std::pop_heap
+	StampedBuffer<uint32_t> m_distance{UINT32_MAX};
+	Heuristic m_heuristic = Heuristic::Manhattan;
+	Heuristic m_activeHeuristic = Heuristic::Manhattan;
+};
+
+// A* over jump points only, for 4-connected unit cost grids (the never-diagonal rules of PathFinding.js). cell costs are ignored.
+// straight runs without forced neighbours are skipped over, so pathParent() links jump points that share a row or a column
+class JpsSolver : public AStarSolver {
+public:
+	using AStarSolver::AStarSolver;
+
+protected:
+	[[nodiscard]]
+	bool expand() noexcept override;
+
+private:
+	// first jump point met walking from (row, col) in direction (rowStep, colStep), GridModel::npos if none
+	[[nodiscard]]
+	uint32_t jump(ptrdiff_t row, ptrdiff_t col, int32_t rowStep, int32_t colStep) const noexcept;
+	[[nodiscard]]
+	uint32_t jumpHorizontal(ptrdiff_t row, ptrdiff_t col, int32_t colStep) const noexcept;
+	[[nodiscard]]
+	bool walkable(ptrdiff_t row, ptrdiff_t col) const noexcept;
+	void jumpFrom(uint32_t cell, int32_t rowStep, int32_t colStep) noexcept;
+};
+
+inline SearchSolver::SearchSolver(const GridModel & grid) : m_grid(grid) {
+}
+
+inline SearchSolver::Status SearchSolver::status() const noexcept {
+	return m_status;
+}
+
+inline uint32_t SearchSolver::current() const noexcept {
+	return m_current;
+}
+
+inline uint32_t SearchSolver::currentDistance() const noexcept {
+	return m_currentDistance;
+}
+
+inline uint32_t SearchSolver::pathParent(const uint32_t cell) const noexcept {
+	return m_pathParent.get(cell);
+}
+
+inline const SearchStats & SearchSolver::stats() const noexcept {
+	return m_stats;
+}
+
+inline bool SearchSolver::reachedTarget() const noexcept {
+	return m_current == m_target;
+}
+
+inline uint32_t SearchSolver::currentParent() const noexcept {
+	return m_pathParent.get(m_current);
+}
+
+inline void SearchSolver::setTrace(TraceRecorder * const trace) noexcept {
+	m_trace = trace;
+}
+
+inline void SearchSolver::setComponents(ComponentIndex * const components) noexcept {
+	m_components = components;
+}
+
+inline void SearchSolver::recordPush(const uint32_t cell) noexcept {
+	m_stats.pushed++;
+
+	if(m_trace) {
+		m_trace->recordPush(cell);
+	}
+}
+
+inline SearchSolver::Status SearchSolver::run() noexcept {
+	while(step() == Status::Running)
+		;
+
+	return m_status;
+}
+
+template<typename Queue>
+BasicDijkstraSolver<Queue>::BasicDijkstraSolver(const GridModel & grid, Queue queue) : SearchSolver(grid), m_priorityQueue(std::move(queue)) {
+}
+
+template<typename Queue>
+size_t BasicDijkstraSolver<Queue>::frontierSize() const noexcept {
+	return m_priorityQueue.size();
+}
+
+inline size_t BfsSolver::frontierSize() const noexcept {
+	return m_queue.size() - m_queueHead;
+}
+
+inline size_t DfsSolver::frontierSize() const noexcept {
+	return m_stack.size();
+}
+
+inline size_t AStarSolver::frontierSize() const noexcept {
+	return m_openList.size();
+}
+
+inline size_t BidirectionalBfsSolver::frontierSize() const noexcept {
+	return m_frontiers[0].queue.size() - m_frontiers[0].head + m_frontiers[1].queue.size() - m_frontiers[1].head;
+}
+
+inline size_t BidirectionalDijkstraSolver::frontierSize() const noexcept {
+	return m_frontiers[0].heap.size() + m_frontiers[1].heap.size();
+}
+
+inline bool AStarSolver::Entry::operator>(const Entry & other) const noexcept {
+	return priority != other.priority ? priority > other.priority : estimate > other.estimate;
+}
+
+inline void AStarSolver::setHeuristic(const Heuristic heuristic) noexcept {
+	m_heuristic = heuristic;
+}
+
+inline Heuristic AStarSolver::heuristic() const noexcept {
+	return m_heuristic;
+}
+
+inline bool JpsSolver::walkable(const ptrdiff_t row, const ptrdiff_t col) const noexcept {
+	return m_grid.validCordinate(row, col) && !m_grid.isBlock(m_grid.index(static_cast<uint32_t>(row), static_cast<uint32_t>(col)));
+}
+
+inline bool BidirectionalBfsSolver::reachedTarget() const noexcept {
+	return m_met;
+}
+
+inline uint32_t BidirectionalBfsSolver::currentParent() const noexcept {
+	return m_side ? m_backwardParent.get(m_current) : m_pathParent.get(m_current);
+}
+
+inline bool BidirectionalDijkstraSolver::reachedTarget() const noexcept {
+	return m_met;
+}
+
+inline uint32_t BidirectionalDijkstraSolver::currentParent() const noexcept {
+	return m_side ? m_backwardParent.get(m_current) : m_pathParent.get(m_current);
+}
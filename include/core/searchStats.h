@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// counters of one search, kept by SearchSolver from start() on
+struct SearchStats {
+	uint64_t expanded = 0;     // steps that popped a cell
+	uint64_t pushed = 0;	   // frontier insertions, the seed included
+	uint64_t stalePops = 0;	   // lazily deleted entries popped and skipped, only queues without decrease-key have them
+	size_t peakFrontier = 0;   // largest frontier after any step, stale entries included
+	uint32_t pathLength = 0;   // moves from source to target, 0 unless found
+	uint64_t pathCost = 0;	   // sum of GridModel::cost() over the path after the source, whatever metric the solver minimised
+	double solverSeconds = 0;  // time spent searching, filled in by whoever drives the solver
+};
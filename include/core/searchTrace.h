@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <iosfwd>
+#include "core/gridModel.h"
+
+// receives every frontier push and pop of a SearchSolver, see SearchSolver::setTrace
+class TraceRecorder {
+public:
+	TraceRecorder() = default;
+	TraceRecorder(const TraceRecorder & other) = delete;
+	TraceRecorder(TraceRecorder && other) = delete;
+	TraceRecorder & operator=(const TraceRecorder & other) = delete;
+	TraceRecorder & operator=(TraceRecorder && other) = delete;
+	virtual ~TraceRecorder() = default;
+
+	virtual void begin(const GridModel & grid, uint32_t source, uint32_t target) noexcept = 0;
+	virtual void recordPush(uint32_t cell) noexcept = 0;
+	virtual void recordPop(uint32_t cell, uint32_t parent, uint32_t distance) noexcept = 0;
+	// path is source first, empty unless found
+	virtual void finish(bool found, const std::vector<uint32_t> & path) noexcept = 0;
+};
+
+// compact log of one search: every pop with its parent and distance, and the pushes made before it.
+// the parent of a push is the pop it is recorded with, except for the seed which is recorded with step 0.
+// the state of any cell at any recorded position is an O(1) lookup so players can seek either way, even while recording.
+// solvers that repair values (D* Lite) pop a cell again, every pop is kept and a cell is seen from its first one
+class SearchTrace : public TraceRecorder {
+	struct Step {
+		uint32_t cell;
+		uint32_t parent;
+		uint32_t distance;
+		uint32_t pushEnd; // one past the last push of this step in m_pushes
+	};
+
+public:
+	enum class Phase : uint8_t {
+		Unseen,
+		Active, // popped, none of its children popped yet
+		Visited
+	};
+
+	// drops the previous log and snapshots the blocks of grid so the trace can be replayed on its own. the blocks are kept
+	// when grid has not changed since the last begin()
+	void begin(const GridModel & grid, uint32_t source, uint32_t target) noexcept override;
+	void recordPush(uint32_t cell) noexcept override;
+	void recordPop(uint32_t cell, uint32_t parent, uint32_t distance) noexcept override;
+	void finish(bool found, const std::vector<uint32_t> & path) noexcept override;
+	void clear() noexcept;
+
+	[[nodiscard]]
+	bool empty() const noexcept;
+	// finish() was called, no more steps will follow
+	[[nodiscard]]
+	bool complete() const noexcept;
+	[[nodiscard]]
+	uint32_t stepCount() const noexcept;
+	[[nodiscard]]
+	uint32_t cell(uint32_t step) const noexcept;
+	[[nodiscard]]
+	uint32_t parent(uint32_t step) const noexcept;
+	[[nodiscard]]
+	uint32_t distance(uint32_t step) const noexcept;
+	// [first, last) of the cells pushed by step
+	[[nodiscard]]
+	std::pair<const uint32_t *, const uint32_t *> pushes(uint32_t step) const noexcept;
+	[[nodiscard]]
+	size_t pushCount() const noexcept;
+
+	// last step before position that popped cell, GridModel::npos if none did. walks back over the later pops of cell
+	[[nodiscard]]
+	uint32_t popStep(uint32_t cell, uint32_t position) const noexcept;
+	// phase of cell once the first position steps are applied
+	[[nodiscard]]
+	Phase phaseAt(uint32_t cell, uint32_t position) const noexcept;
+
+	[[nodiscard]]
+	bool found() const noexcept;
+	[[nodiscard]]
+	const std::vector<uint32_t> & path() const noexcept;
+	[[nodiscard]]
+	uint32_t source() const noexcept;
+	[[nodiscard]]
+	uint32_t target() const noexcept;
+	[[nodiscard]]
+	uint32_t rowCount() const noexcept;
+	[[nodiscard]]
+	uint32_t colCount() const noexcept;
+	[[nodiscard]]
+	bool isBlock(uint32_t cell) const noexcept;
+
+	// native byte order, meant for sharing between builds on the same kind of machine
+	[[nodiscard]]
+	bool write(std::ostream & stream) const noexcept;
+	// false and an empty trace on a malformed or truncated stream. memory follows the data actually read, not the counts
+	// of the header
+	[[nodiscard]]
+	bool read(std::istream & stream) noexcept;
+
+private:
+	void buildIndex() noexcept;
+
+	///
+	constexpr static uint32_t magic = 0x52545650; // "PVTR"
+	constexpr static uint32_t version = 1;
+
+	uint32_t m_rowCnt = 0;
+	uint32_t m_colCnt = 0;
+	uint32_t m_source = GridModel::npos;
+	uint32_t m_target = GridModel::npos;
+	uint64_t m_gridVersion = 0; // of the grid the blocks were copied from, 0 unless begin() copied them
+	bool m_found = false;
+	bool m_complete = false;
+	std::vector<uint8_t> m_blocked;
+	std::vector<Step> m_steps;
+	std::vector<uint32_t> m_pushes;
+	std::vector<uint32_t> m_path;
+	std::vector<uint32_t> m_firstPop;	    // per cell
+	std::vector<uint32_t> m_lastPop;	    // per cell
+	std::vector<uint32_t> m_previousPop; // per step, the step that popped its cell before or GridModel::npos
+	std::vector<uint32_t> m_retireStep;  // per cell, first step popping one of its children
+};
+
+inline void SearchTrace::recordPush(const uint32_t cell) noexcept {
+	m_pushes.push_back(cell);
+}
+
+inline void SearchTrace::recordPop(const uint32_t cell, const uint32_t parent, const uint32_t distance) noexcept {
+	const auto step = static_cast<uint32_t>(m_steps.size());
+	m_steps.push_back({cell, parent, distance, static_cast<uint32_t>(m_pushes.size())});
+	m_previousPop.push_back(m_lastPop[cell]);
+	m_lastPop[cell] = step;
+
+	if(m_firstPop[cell] == GridModel::npos) {
+		m_firstPop[cell] = step;
+	}
+
+	if(parent != GridModel::npos && m_retireStep[parent] == GridModel::npos) {
+		m_retireStep[parent] = step;
+	}
+}
+
+inline bool SearchTrace::empty() const noexcept {
+	return m_steps.empty();
+}
+
+inline bool SearchTrace::complete() const noexcept {
+	return m_complete;
+}
+
+inline uint32_t SearchTrace::stepCount() const noexcept {
+	return static_cast<uint32_t>(m_steps.size());
+}
+
+inline uint32_t SearchTrace::cell(const uint32_t step) const noexcept {
+	return m_steps[step].cell;
+}
+
+inline uint32_t SearchTrace::parent(const uint32_t step) const noexcept {
+	return m_steps[step].parent;
+}
+
+inline uint32_t SearchTrace::distance(const uint32_t step) const noexcept {
+	return m_steps[step].distance;
+}
+
+inline std::pair<const uint32_t *, const uint32_t *> SearchTrace::pushes(const uint32_t step) const noexcept {
+	const uint32_t first = step ? m_steps[step - 1].pushEnd : 0;
+	return {m_pushes.data() + first, m_pushes.data() + m_steps[step].pushEnd};
+}
+
+inline size_t SearchTrace::pushCount() const noexcept {
+	return m_pushes.size();
+}
+
+inline uint32_t SearchTrace::popStep(const uint32_t cell, const uint32_t position) const noexcept {
+	uint32_t step = m_lastPop[cell];
+
+	while(step != GridModel::npos && step >= position) {
+		step = m_previousPop[step];
+	}
+
+	return step;
+}
+
+inline SearchTrace::Phase SearchTrace::phaseAt(const uint32_t cell, const uint32_t position) const noexcept {
+	const uint32_t popped = m_firstPop[cell];
+
+	if(popped == GridModel::npos || popped >= position) {
+		return Phase::Unseen;
+	}
+
+	const uint32_t retired = m_retireStep[cell];
+	return retired != GridModel::npos && retired < position ? Phase::Visited : Phase::Active;
+}
+
+inline bool SearchTrace::found() const noexcept {
+	return m_found;
+}
+
+inline const std::vector<uint32_t> & SearchTrace::path() const noexcept {
+	return m_path;
+}
+
+inline uint32_t SearchTrace::source() const noexcept {
+	return m_source;
+}
+
+inline uint32_t SearchTrace::target() const noexcept {
+	return m_target;
+}
+
+inline uint32_t SearchTrace::rowCount() const noexcept {
+	return m_rowCnt;
+}
+
+inline uint32_t SearchTrace::colCount() const noexcept {
+	return m_colCnt;
+}
+
+inline bool SearchTrace::isBlock(const uint32_t cell) const noexcept {
+	return m_blocked[cell];
+}
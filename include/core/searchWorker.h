@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <array>
+#include <vector>
+#include "core/searchSolver.h"
+#include "core/spscRing.h"
+
+// runs one SearchSolver on its own thread and hands every push and pop over to a single consumer through a lock free ring.
+// the producer blocks while the ring is full, so a consumer that stops draining also pauses the search
+class SearchWorker {
+	enum class Kind : uint32_t {
+		Push,
+		Pop,
+		PathCell,
+		Found,
+		Exhausted
+	};
+
+	struct Event {
+		Kind kind;
+		uint32_t cell;
+		uint32_t parent;
+		uint32_t distance;
+	};
+
+	// fills a local batch on the worker thread and publishes it to the ring once full
+	class RingRecorder : public TraceRecorder {
+	public:
+		explicit RingRecorder(SearchWorker & worker);
+
+		void begin(const GridModel & grid, uint32_t source, uint32_t target) noexcept override;
+		void recordPush(uint32_t cell) noexcept override;
+		void recordPop(uint32_t cell, uint32_t parent, uint32_t distance) noexcept override;
+		void finish(bool found, const std::vector<uint32_t> & path) noexcept override;
+		void flush() noexcept;
+		// time flush() spent waiting for the consumer to make room
+		[[nodiscard]]
+		std::chrono::steady_clock::duration blocked() const noexcept;
+
+	private:
+		void append(const Event & event) noexcept;
+
+		///
+		constexpr static size_t batchSize = 256;
+		SearchWorker & m_worker;
+		std::array<Event, batchSize> m_batch{};
+		size_t m_batchSize = 0;
+		std::chrono::steady_clock::duration m_blocked{};
+	};
+
+public:
+	constexpr static size_t defaultCapacity = 1 << 16; // events
+
+	explicit SearchWorker(size_t capacity = defaultCapacity);
+	SearchWorker(const SearchWorker & other) = delete;
+	SearchWorker(SearchWorker && other) = delete;
+	SearchWorker & operator=(const SearchWorker & other) = delete;
+	SearchWorker & operator=(SearchWorker && other) = delete;
+	~SearchWorker();
+
+	// cancels the previous search. solver and its grid must stay untouched until the search is drained or cancelled
+	void start(SearchSolver & solver, uint32_t source, uint32_t target) noexcept;
+	// stops the worker and drops whatever it published but was not drained yet
+	void cancel() noexcept;
+	// a search was started and its last event was not drained yet
+	[[nodiscard]]
+	bool active() const noexcept;
+	// consumer side, replays up to maxEvents published events into recorder. begin() is left to the caller
+	size_t drain(TraceRecorder & recorder, size_t maxEvents) noexcept;
+	// of the last search, valid once its outcome was drained. solverSeconds leaves out the time the full ring held it back
+	[[nodiscard]]
+	const SearchStats & stats() const noexcept;
+
+private:
+	void work(SearchSolver & solver, uint32_t source, uint32_t target) noexcept;
+	void join() noexcept;
+
+	///
+	SpscRing<Event> m_ring;
+	std::vector<Event> m_drained; // consumer side batch
+	std::vector<uint32_t> m_path;	// consumer side, collected until the outcome arrives
+	std::thread m_thread;
+	std::atomic<bool> m_cancel{false};
+	SearchStats m_stats; // written by the worker right before it exits, read after joining it
+	bool m_active = false;
+};
+
+inline SearchWorker::RingRecorder::RingRecorder(SearchWorker & worker) : m_worker(worker) {
+}
+
+inline void SearchWorker::RingRecorder::begin(const GridModel &, uint32_t, uint32_t) noexcept {
+	m_batchSize = 0;
+}
+
+inline void SearchWorker::RingRecorder::recordPush(const uint32_t cell) noexcept {
+	append({Kind::Push, cell, GridModel::npos, 0});
+}
+
+inline void SearchWorker::RingRecorder::recordPop(const uint32_t cell, const uint32_t parent, const uint32_t distance) noexcept {
+	append({Kind::Pop, cell, parent, distance});
+}
+
+inline void SearchWorker::RingRecorder::finish(const bool found, const std::vector<uint32_t> & path) noexcept {
+	for(const auto cell : path) {
+		append({Kind::PathCell, cell, GridModel::npos, 0});
+	}
+
+	append({found ? Kind::Found : Kind::Exhausted, GridModel::npos, GridModel::npos, 0});
+	flush();
+}
+
+inline void SearchWorker::RingRecorder::append(const Event & event) noexcept {
+	m_batch[m_batchSize++] = event;
+
+	if(m_batchSize == batchSize) {
+		flush();
+	}
+}
+
+inline std::chrono::steady_clock::duration SearchWorker::RingRecorder::blocked() const noexcept {
+	return m_blocked;
+}
+
+inline SearchWorker::SearchWorker(const size_t capacity) : m_ring(capacity), m_drained(m_ring.capacity()) {
+}
+
+inline SearchWorker::~SearchWorker() {
+	cancel();
+}
+
+inline bool SearchWorker::active() const noexcept {
+	return m_active;
+}
+
+inline const SearchStats & SearchWorker::stats() const noexcept {
+	return m_stats;
+}
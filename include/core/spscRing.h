@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+// bounded lock free queue between exactly one producer thread and one consumer thread.
+// head and tail only grow, the slot of an index is index & mask, and each side owns one of them
+template<typename T>
+class SpscRing {
+public:
+	// capacity is rounded up to a power of two
+	explicit SpscRing(size_t capacity);
+	SpscRing(const SpscRing & other) = delete;
+	SpscRing(SpscRing && other) = delete;
+	SpscRing & operator=(const SpscRing & other) = delete;
+	SpscRing & operator=(SpscRing && other) = delete;
+
+	// producer side, pushes as many of values as fit and returns how many did
+	size_t push(const T * values, size_t count) noexcept;
+	// consumer side, pops up to count values and returns how many were popped
+	size_t pop(T * values, size_t count) noexcept;
+	// only while neither side is active
+	void reset() noexcept;
+	[[nodiscard]]
+	size_t capacity() const noexcept;
+
+private:
+	constexpr static size_t cacheLine = 64;
+
+	std::vector<T> m_slots;
+	size_t m_mask;
+	alignas(cacheLine) std::atomic<size_t> m_head{0}; // next index to pop, written by the consumer
+	alignas(cacheLine) std::atomic<size_t> m_tail{0}; // next index to push, written by the producer
+};
+
+template<typename T>
+SpscRing<T>::SpscRing(const size_t capacity) {
+	size_t rounded = 1;
+
+	while(rounded < capacity) {
+		rounded <<= 1;
+	}
+
+	m_slots.resize(rounded);
+	m_mask = rounded - 1;
+}
+
+template<typename T>
+size_t SpscRing<T>::push(const T * values, const size_t count) noexcept {
+	const size_t tail = m_tail.load(std::memory_order_relaxed);
+	const size_t head = m_head.load(std::memory_order_acquire);
+	const size_t pushed = std::min(count, m_slots.size() - (tail - head));
+
+	for(size_t index = 0; index < pushed; index++) {
+		m_slots[(tail + index) & m_mask] = values[index];
+	}
+
+	// publishes the slots written above to the consumer
+	m_tail.store(tail + pushed, std::memory_order_release);
+	return pushed;
+}
+
+template<typename T>
+size_t SpscRing<T>::pop(T * values, const size_t count) noexcept {
+	const size_t head = m_head.load(std::memory_order_relaxed);
+	const size_t tail = m_tail.load(std::memory_order_acquire);
+	const size_t popped = std::min(count, tail - head);
+
+	for(size_t index = 0; index < popped; index++) {
+		values[index] = m_slots[(head + index) & m_mask];
+	}
+
+	// hands the slots read above back to the producer
+	m_head.store(head + popped, std::memory_order_release);
+	return popped;
+}
+
+template<typename T>
+void SpscRing<T>::reset() noexcept {
+	m_head.store(0, std::memory_order_relaxed);
+	m_tail.store(0, std::memory_order_relaxed);
+}
+
+template<typename T>
+size_t SpscRing<T>::capacity() const noexcept {
+	return m_slots.size();
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+// flat per-cell buffer with O(1) clear(): a slot only holds a value while its stamp matches the current generation
+template<typename T>
+class StampedBuffer {
+	struct Slot {
+		uint32_t stamp;
+		T value;
+	};
+
+public:
+	explicit StampedBuffer(T fallback = T{});
+
+	// grows or shrinks to size cells, everything reads as fallback afterwards
+	void resize(size_t size) noexcept;
+	void clear() noexcept;
+	[[nodiscard]]
+	size_t size() const noexcept;
+	[[nodiscard]]
+	bool contains(size_t cell) const noexcept;
+	[[nodiscard]]
+	T get(size_t cell) const noexcept;
+	void set(size_t cell, T value) noexcept;
+
+private:
+	std::vector<Slot> m_slots;
+	uint32_t m_generation = 1;
+	T m_fallback;
+};
+
+// stamp-only variant for visited flags
+class StampedSet {
+public:
+	void resize(size_t size) noexcept;
+	void clear() noexcept;
+	[[nodiscard]]
+	bool contains(size_t cell) const noexcept;
+	void insert(size_t cell) noexcept;
+
+private:
+	std::vector<uint32_t> m_stamps;
+	uint32_t m_generation = 1;
+};
+
+template<typename T>
+StampedBuffer<T>::StampedBuffer(T fallback) : m_fallback(fallback) {
+}
+
+template<typename T>
+void StampedBuffer<T>::resize(const size_t size) noexcept {
+	if(size != m_slots.size()) {
+		m_slots.assign(size, Slot{0, m_fallback});
+		m_generation = 1;
+	} else {
+		clear();
+	}
+}
+
+template<typename T>
+void StampedBuffer<T>::clear() noexcept {
+	if(++m_generation == 0) { // wrapped, stale stamps could alias again
+		std::fill(m_slots.begin(), m_slots.end(), Slot{0, m_fallback});
+		m_generation = 1;
+	}
+}
+
+template<typename T>
+size_t StampedBuffer<T>::size() const noexcept {
+	return m_slots.size();
+}
+
+template<typename T>
+bool StampedBuffer<T>::contains(const size_t cell) const noexcept {
+	return m_slots[cell].stamp == m_generation;
+}
+
+template<typename T>
+T StampedBuffer<T>::get(const size_t cell) const noexcept {
+	const auto & slot = m_slots[cell];
+	return slot.stamp == m_generation ? slot.value : m_fallback;
+}
+
+template<typename T>
+void StampedBuffer<T>::set(const size_t cell, T value) noexcept {
+	m_slots[cell] = Slot{m_generation, value};
+}
+
+inline void StampedSet::resize(const size_t size) noexcept {
+	if(size != m_stamps.size()) {
+		m_stamps.assign(size, 0);
+		m_generation = 1;
+	} else {
+		clear();
+	}
+}
+
+inline void StampedSet::clear() noexcept {
+	if(++m_generation == 0) {
+		std::fill(m_stamps.begin(), m_stamps.end(), 0);
+		m_generation = 1;
+	}
+}
+
+inline bool StampedSet::contains(const size_t cell) const noexcept {
+	return m_stamps[cell] == m_generation;
+}
+
+inline void StampedSet::insert(const size_t cell) noexcept {
+	m_stamps[cell] = m_generation;
+}
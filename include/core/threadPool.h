@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+// fixed set of worker threads for fork-join rounds: run() hands one task to every thread and returns once all finished it
+class ThreadPool {
+public:
+	// threadCount counts the calling thread as well, 0 picks the hardware concurrency
+	explicit ThreadPool(size_t threadCount = 0);
+	ThreadPool(const ThreadPool & other) = delete;
+	ThreadPool(ThreadPool && other) = delete;
+	ThreadPool & operator=(const ThreadPool & other) = delete;
+	ThreadPool & operator=(ThreadPool && other) = delete;
+	~ThreadPool();
+
+	[[nodiscard]]
+	size_t size() const noexcept;
+	// calls task(index) once for every index below size(), index 0 on the calling thread
+	void run(const std::function<void(size_t index)> & task) noexcept;
+
+private:
+	void work(size_t index) noexcept;
+
+	///
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	const std::function<void(size_t)> * m_task = nullptr;
+	uint64_t m_round = 0; // bumped by every run(), workers wait for a round they have not served yet
+	size_t m_pending = 0; // workers still busy with the current round
+	bool m_stop = false;
+};
+
+inline size_t ThreadPool::size() const noexcept {
+	return m_threads.size() + 1;
+}
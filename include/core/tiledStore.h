@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+class GridModel;
+
+// read only cells of a .pvtiles file, for grids that should not live in memory as a whole. the grid is cut into square
+// tiles of tileSize cells a side, each stored as one page aligned record of block bits followed by one cost byte per cell.
+// a tile is mapped on its first access and the least recently used one is unmapped once more than the resident limit are
+// mapped, so memory follows the tiles a search or a paint touches rather than the grid. lookups mutate the LRU, a store
+// must not be read from two threads at once, debug builds assert on it. copy() gives another thread a store of its own
+class TiledStore {
+	struct Resident {
+		uint32_t tile;
+		void * mapping;
+		size_t length;
+	};
+
+	// shared by a store and its copies. mmap takes the offset explicitly, so they map from it concurrently
+	struct File {
+		int descriptor;
+
+		explicit File(int descriptor) noexcept;
+		File(const File & other) = delete;
+		File & operator=(const File & other) = delete;
+		~File();
+	};
+
+public:
+	constexpr static uint32_t tileSize = 128;
+	constexpr static size_t defaultResidentLimit = 1024; // tiles, 20 MiB of records
+
+	// nullptr if the file cannot be opened or is not a .pvtiles file of valid dimensions
+	[[nodiscard]]
+	static std::shared_ptr<TiledStore> open(const std::string & path, size_t residentLimit = defaultResidentLimit) noexcept;
+	// streams grid out tile by tile
+	[[nodiscard]]
+	static bool write(const GridModel & grid, const std::string & path) noexcept;
+	// the magic a .pvtiles file starts with
+	[[nodiscard]]
+	static bool isTiledFile(const uint8_t * data, size_t size) noexcept;
+
+	TiledStore(const TiledStore & other) = delete;
+	TiledStore(TiledStore && other) = delete;
+	TiledStore & operator=(const TiledStore & other) = delete;
+	TiledStore & operator=(TiledStore && other) = delete;
+	~TiledStore();
+
+	// the same file with no tile resident yet and failed() carried over
+	[[nodiscard]]
+	std::shared_ptr<TiledStore> copy() const;
+	[[nodiscard]]
+	uint32_t rowCount() const noexcept;
+	[[nodiscard]]
+	uint32_t colCount() const noexcept;
+	[[nodiscard]]
+	bool isBlock(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	uint8_t cost(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	size_t residentTiles() const noexcept;
+	// tiles mapped over the lifetime of the store, reloads of evicted ones included
+	[[nodiscard]]
+	uint64_t tileLoads() const noexcept;
+	// a tile could not be mapped (out of address space, a vanished file) and the lookup answered a block that may not be
+	// in the file. stays set, whatever was derived from the cells since, a path or a cached abstraction, is void
+	[[nodiscard]]
+	bool failed() const noexcept;
+
+private:
+	// flags lookups of two threads that overlap
+	struct ReadGuard {
+		explicit ReadGuard(std::atomic<bool> & reading) noexcept;
+		ReadGuard(const ReadGuard & other) = delete;
+		ReadGuard & operator=(const ReadGuard & other) = delete;
+		~ReadGuard();
+
+		std::atomic<bool> & reading;
+	};
+
+	TiledStore(std::shared_ptr<const File> file, uint32_t rowCnt, uint32_t colCnt, size_t residentLimit);
+
+	// record of the tile holding cell, cell turned into its index within the tile
+	[[nodiscard]]
+	const uint8_t * record(uint32_t & cell) const noexcept;
+	// nullptr if the tile cannot be mapped
+	[[nodiscard]]
+	const uint8_t * load(uint32_t tile) const noexcept;
+	// what a lookup of a tile that cannot be mapped reads, after failed() was set
+	[[nodiscard]]
+	static const uint8_t * unreadable() noexcept;
+
+	///
+	constexpr static size_t blockBytes = tileSize * tileSize / 8;
+	constexpr static size_t recordBytes = (blockBytes + tileSize * tileSize + 4095) / 4096 * 4096;
+
+	std::shared_ptr<const File> m_file;
+	uint32_t m_rowCnt;
+	uint32_t m_colCnt;
+	uint32_t m_tileCols;
+	size_t m_residentLimit;
+	mutable std::vector<const uint8_t *> m_records;			  // per tile, nullptr unless it is resident
+	mutable std::vector<std::list<Resident>::iterator> m_residents; // per tile, its node in m_lru while resident
+	mutable std::list<Resident> m_lru;				  // most recently used first
+	mutable uint32_t m_lastTile = UINT32_MAX;			  // most lookups stay on one tile, they skip the LRU
+	mutable const uint8_t * m_lastRecord = nullptr;
+	mutable uint64_t m_tileLoads = 0;
+	mutable bool m_failed = false;
+	mutable std::atomic<bool> m_reading = false; // a lookup is running, checked by debug builds only
+};
+
+inline uint32_t TiledStore::rowCount() const noexcept {
+	return m_rowCnt;
+}
+
+inline uint32_t TiledStore::colCount() const noexcept {
+	return m_colCnt;
+}
+
+inline bool TiledStore::isBlock(uint32_t cell) const noexcept {
+	const uint8_t * const tile = record(cell);
+	return tile[cell / 8] >> cell % 8 & 1;
+}
+
+inline uint8_t TiledStore::cost(uint32_t cell) const noexcept {
+	const uint8_t * const tile = record(cell);
+	return tile[blockBytes + cell];
+}
+
+inline size_t TiledStore::residentTiles() const noexcept {
+	return m_lru.size();
+}
+
+inline uint64_t TiledStore::tileLoads() const noexcept {
+	return m_tileLoads;
+}
+
+inline bool TiledStore::failed() const noexcept {
+	return m_failed;
+}
+
+inline TiledStore::ReadGuard::ReadGuard(std::atomic<bool> & reading) noexcept : reading(reading) {
+	[[maybe_unused]] const bool idle = !reading.exchange(true, std::memory_order_acquire);
+	assert(idle && "a TiledStore is read from two threads at once, give each thread a copy");
+}
+
+inline TiledStore::ReadGuard::~ReadGuard() {
+	reading.store(false, std::memory_order_release);
+}
+
+inline const uint8_t * TiledStore::record(uint32_t & cell) const noexcept {
+#ifndef NDEBUG
+	const ReadGuard guard(m_reading);
+#endif
+	const uint32_t row = cell / m_colCnt;
+	const uint32_t col = cell % m_colCnt;
+	const uint32_t tile = row / tileSize * m_tileCols + col / tileSize;
+	cell = row % tileSize * tileSize + col % tileSize;
+
+	if(tile == m_lastTile) {
+		return m_lastRecord;
+	}
+
+	if(m_records[tile]) {
+		m_lru.splice(m_lru.begin(), m_lru, m_residents[tile]);
+	} else if(!load(tile)) {
+		// not cached, the next lookup of the tile tries to map it again
+		return unreadable();
+	}
+
+	m_lastTile = tile;
+	m_lastRecord = m_records[tile];
+	return m_lastRecord;
+}
@@ -15,4 +15,28 @@ inline const QString dfsInfo =
 
 inline const QString dijkstraInfo = "<strong>Dijkstra's algorithm</strong> is an algorithm for finding the shortest paths between nodes in "
 						"a graph, which may represent, for example, road networks. It follows a greedy approach. Read more on "
-						"<a href ='https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm'>wikipedia.</a>";
\ No newline at end of file
+						"<a href ='https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm'>wikipedia.</a>";
+
+inline const QString aStarInfo = "<strong>A* search</strong> is Dijkstra's algorithm guided by a heuristic: it always expands the node with the "
+					   "lowest distance travelled plus estimated distance left. As long as the estimate never overshoots, the path "
+					   "found is still the shortest one, yet far fewer nodes are expanded. Read more on "
+					   "<a href='https://en.wikipedia.org/wiki/A*_search_algorithm'>wikipedia.</a>";
+
+inline const QString jpsInfo = "<strong>Jump Point Search (JPS)</strong> is A* for grids where every step costs the same. Rather than "
+					 "expanding every neighbour it jumps along straight runs and only stops at <i>jump points</i>, cells right past "
+					 "an obstacle corner where a shorter path could turn. Paths stay optimal while far fewer nodes are expanded. "
+					 "Read more on <a href='https://en.wikipedia.org/wiki/Jump_point_search'>wikipedia.</a>";
+
+inline const QString hpaInfo = "<strong>Hierarchical pathfinding (HPA*)</strong> cuts the grid into clusters and links them through "
+					 "<i>entrances</i> on their borders, with the cost between any two entrances of a cluster worked out ahead of "
+					 "time. A search then only visits entrances, shown as jump points, and the path is filled in cluster by cluster. "
+					 "Queries stay fast however large the grid, and only the clusters around an edit are recomputed. Paths are "
+					 "close to, but not always, the shortest. Read more in "
+					 "<a href='https://webdocs.cs.ualberta.ca/~mmueller/ps/hpastar.pdf'>the paper.</a>";
+
+inline const QString dStarLiteInfo = "<strong>D* Lite</strong> searches backwards from the target and keeps what it learned between "
+						 "runs. Once a run finished, toggle some blocks or drop the source elsewhere: the path is repaired "
+						 "right away, and only the part of the search the change touched is redone, so the repair expands a "
+						 "handful of nodes where the others start over. Moving the target still starts from scratch. Paths "
+						 "are the shortest ones. Read more on "
+						 "<a href='https://en.wikipedia.org/wiki/D*'>wikipedia.</a>";
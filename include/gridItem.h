@@ -0,0 +1,210 @@
+#pragma once
+
+#include <QGraphicsObject>
+#include <QPainter>
+#include <vector>
+#include <array>
+#include "core/gridModel.h"
+#include "animationClock.h"
+
+class QGraphicsSceneMouseEvent;
+
+// paints every cell of a GridModel from a byte per cell state buffer, blocks and costs are read from the model itself
+class GridItem : public QGraphicsObject {
+	Q_OBJECT
+public:
+	enum class State : uint8_t {
+		Source,
+		Target,
+		Active,
+		Inactive,
+		Visited,
+		Block,
+		Inpath,
+		JumpPoint
+	};
+
+	constexpr static size_t stateCount = 8;
+	constexpr static uint8_t wallBrush = 0; // setBrush() value that toggles blocks instead of painting a cost
+
+	GridItem(GridModel & grid, AnimationClock & clock, int32_t spacing, QGraphicsItem * parent = nullptr);
+	GridItem(const GridItem & other) = delete;
+	GridItem(GridItem && other) = delete;
+	GridItem & operator=(const GridItem & other) = delete;
+	GridItem & operator=(GridItem && other) = delete;
+
+	// newState is one of Active, Inactive, Visited, Inpath, JumpPoint. pathParent orients the active icon
+	void setState(uint32_t cell, State newState, bool runAnimations = true, uint32_t pathParent = GridModel::npos) noexcept;
+	[[nodiscard]]
+	State getState(uint32_t cell) const noexcept;
+	void setBlock(uint32_t cell, bool block, bool runAnimations = true) noexcept;
+	// unblocks cell and makes stepping onto it cost cost
+	void setCost(uint32_t cell, uint8_t cost, bool runAnimations = true) noexcept;
+	// what dragging over non special cells paints, wallBrush or a cost
+	void setBrush(uint8_t brush) noexcept;
+	void setSource(uint32_t cell) noexcept;
+	void setTarget(uint32_t cell) noexcept;
+	[[nodiscard]]
+	uint32_t source() const noexcept;
+	[[nodiscard]]
+	uint32_t target() const noexcept;
+	[[nodiscard]]
+	bool isSpecial(uint32_t cell) const noexcept;
+	// every non special cell back to Inactive without animations, blocks and costs are kept unless asked otherwise
+	void clearStates(bool clearBlocks) noexcept;
+
+	[[nodiscard]]
+	QRectF boundingRect() const noexcept override;
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) noexcept override;
+
+protected:
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) noexcept override;
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) noexcept override;
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) noexcept override;
+
+private:
+	enum class DragMode : uint8_t {
+		None,
+		Inverter,
+		Painter,
+		Source,
+		Target
+	};
+
+	struct Tween {
+		uint32_t cell;
+		qint64 startTime; // AnimationClock::now()
+	};
+
+	struct CellRange {
+		uint32_t rowBegin;
+		uint32_t rowEnd;
+		uint32_t colBegin;
+		uint32_t colEnd;
+	};
+
+	void paintCoarse(QPainter * painter, const CellRange & range) const noexcept;
+	void markDirty(uint32_t cell) noexcept;
+	void flushDirty() noexcept;
+	void startTween(uint32_t cell) noexcept;
+	void advanceTweens(qint64 now) noexcept;
+	void invertCell(uint32_t cell) noexcept;
+	void paintCell(uint32_t cell) noexcept;
+	void paintCostShades(QPainter * painter, const CellRange & range) const noexcept;
+	void appendFragment(uint32_t cell, qreal scale) noexcept;
+	[[nodiscard]]
+	qreal tweenScale(qint64 elapsed) const noexcept;
+	[[nodiscard]]
+	uint32_t cellAt(QPointF position) const noexcept;
+	[[nodiscard]]
+	QRectF cellRect(uint32_t cell) const noexcept;
+	[[nodiscard]]
+	CellRange visibleRange(const QRectF & exposedRect) const noexcept;
+	[[nodiscard]]
+	static uint8_t rotationIndex(std::pair<uint32_t, uint32_t> self, std::pair<uint32_t, uint32_t> parent) noexcept;
+
+	///
+	constexpr static int32_t defaultTimerDuration = 175; // ms
+	constexpr static uint32_t tweenCutoff = 950;	     // slider value from which cells switch without animating
+	constexpr static size_t maximumTweens = 4096;	     // further state changes skip their tween until some finish
+	constexpr static int32_t dimension = 32;
+	constexpr static qreal minimumIconSize = 6; // px on screen, below that cells are painted as flat colors
+	constexpr static uint32_t tileSize = 16;	    // cells per edge of a dirty tile
+	constexpr static uint8_t stateMask = 0x07;
+	constexpr static uint8_t rotationShift = 3;
+	constexpr static uint8_t tweenFlag = 0x80;
+	constexpr static QRgb costShade = qRgb(110, 70, 20); // terrain tint, stronger with the cost
+
+	GridModel & m_grid;
+	AnimationClock & m_clock;
+	int32_t m_pitch;
+	uint32_t m_tileCols;
+	std::vector<uint8_t> m_cells; // State | rotation << rotationShift | tweenFlag
+	std::vector<uint8_t> m_dirtyTiles;
+	std::vector<uint32_t> m_dirtyList;
+	bool m_flushPending = false;
+	std::vector<Tween> m_tweens;
+	int32_t m_timerDuration = defaultTimerDuration;
+	bool m_tweensEnabled = true;
+	std::vector<QPainter::PixmapFragment> m_fragments; // reused by paint, one per visible cell
+	uint32_t m_source = GridModel::npos;
+	uint32_t m_target = GridModel::npos;
+	DragMode m_dragMode = DragMode::None;
+	uint8_t m_brush = wallBrush;
+	uint8_t m_dragCost = GridModel::minimumCost; // painted by the current Painter drag
+	uint32_t m_lastDragCell = GridModel::npos;
+	bool m_algorithmRunning = false;
+
+public slots:
+	void setRunningState(bool newAlgorithmState) noexcept;
+	void changeAnimationDuration(uint32_t newDuration) noexcept;
+signals:
+	// the block or cost of cell changed in the model, GridModel::npos when all of them were cleared
+	void cellEdited(uint32_t cell) const;
+};
+
+inline GridItem::State GridItem::getState(const uint32_t cell) const noexcept {
+	if(cell == m_source) {
+		return State::Source;
+	}
+
+	if(cell == m_target) {
+		return State::Target;
+	}
+
+	if(m_grid.isBlock(cell)) {
+		return State::Block;
+	}
+
+	return static_cast<State>(m_cells[cell] & stateMask);
+}
+
+inline void GridItem::setBrush(const uint8_t brush) noexcept {
+	m_brush = brush;
+}
+
+inline uint32_t GridItem::source() const noexcept {
+	return m_source;
+}
+
+inline uint32_t GridItem::target() const noexcept {
+	return m_target;
+}
+
+inline bool GridItem::isSpecial(const uint32_t cell) const noexcept {
+	return cell == m_source || cell == m_target;
+}
+
+inline QRectF GridItem::boundingRect() const noexcept {
+	const int32_t spacing = m_pitch - dimension;
+	return QRectF(0, 0, m_grid.colCount() * m_pitch - spacing, m_grid.rowCount() * m_pitch - spacing);
+}
+
+inline QRectF GridItem::cellRect(const uint32_t cell) const noexcept {
+	const auto [row, col] = m_grid.getCord(cell);
+	return QRectF(col * m_pitch, row * m_pitch, dimension, dimension);
+}
+
+inline void GridItem::setRunningState(const bool newAlgorithmState) noexcept {
+	m_algorithmRunning = newAlgorithmState;
+}
+
+inline void GridItem::changeAnimationDuration(const uint32_t newDuration) noexcept {
+	// new duration comes from slider direclty range : 0 - 1000
+	double factor = static_cast<double>(newDuration) / 1000.0;
+	factor = 1 - factor;
+	const auto delta = static_cast<int32_t>(factor * static_cast<double>(defaultTimerDuration));
+	m_timerDuration = std::max(defaultTimerDuration, delta ? delta * 2 : defaultTimerDuration);
+	m_tweensEnabled = newDuration < tweenCutoff;
+}
+
+inline uint8_t GridItem::rotationIndex(const std::pair<uint32_t, uint32_t> self, const std::pair<uint32_t, uint32_t> parent) noexcept {
+	const auto [selfX, selfY] = self;
+	const auto [parentX, parentY] = parent;
+
+	if(selfX != parentX) { // X axis changed
+		return selfX < parentX ? 1 : 0; // top of parent : below
+	}
+
+	return selfY < parentY ? 2 : 3; // left of parent : right
+}
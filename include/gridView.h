@@ -0,0 +1,33 @@
+#pragma once
+
+#include <QGraphicsView>
+#include <QWheelEvent>
+
+// graphics view over the grid, ctrl + wheel zooms around the cursor so large grids stay navigable
+class GridView : public QGraphicsView {
+	Q_OBJECT
+public:
+	explicit GridView(QGraphicsScene * scene, QWidget * parent = nullptr);
+
+protected:
+	void wheelEvent(QWheelEvent * event) noexcept override;
+
+private:
+	constexpr static double zoomStep = 1.15;
+};
+
+inline GridView::GridView(QGraphicsScene * scene, QWidget * parent) : QGraphicsView(scene, parent) {
+	setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
+	setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+}
+
+inline void GridView::wheelEvent(QWheelEvent * event) noexcept {
+	if(!(event->modifiers() & Qt::ControlModifier)) {
+		QGraphicsView::wheelEvent(event);
+		return;
+	}
+
+	const double factor = event->angleDelta().y() > 0 ? zoomStep : 1 / zoomStep;
+	scale(factor, factor);
+	event->accept();
+}
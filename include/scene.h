@@ -1,19 +1,25 @@
 #pragma once
 
 #include <QGraphicsScene>
-#include <queue>
-#include <stack>
 #include <random>
+#include <cmath>
 #include <QTimer>
 #include <QTabWidget>
-#include <QGraphicsScene>
 #include <QGraphicsDropShadowEffect>
-#include <QGraphicsGridLayout>
 #include <QGridLayout>
 #include <QLineEdit>
 #include <QLabel>
-#include "node.h"
+#include <QElapsedTimer>
+#include <array>
+#include "gridItem.h"
+#include "animationClock.h"
 #include "helpDialog.h"
+#include "core/searchSolver.h"
+#include "core/hpaSolver.h"
+#include "core/dStarLiteSolver.h"
+#include "core/distanceFieldSolver.h"
+#include "core/componentIndex.h"
+#include "core/searchWorker.h"
 
 class QTabWidget;
 class QSize;
@@ -21,6 +27,9 @@ class QHBoxLayout;
 class QVBoxLayout;
 class QGridLayout;
 class QPushButton;
+class QSlider;
+class QCheckBox;
+class QSpinBox;
 
 class GraphicsScene : public QGraphicsScene {
 	Q_OBJECT
@@ -29,104 +38,182 @@ class GraphicsScene : public QGraphicsScene {
 	enum class TabIndex {
 		Bfs,
 		Dfs,
-		Dijkstra
+		Dijkstra,
+		AStar,
+		Jps,
+		Hpa,
+		DStarLite
+	};
+
+	enum class Stepping {
+		Idle,
+		Replay,
+		Path
 	};
 
-	using pIntNode = std::pair<uint32_t, Node *>;
+	struct RunRecord {
+		TabIndex tab;
+		bool bidirectional;
+		QString variant;
+		uint32_t rowCnt;
+		uint32_t colCnt;
+		SearchStats stats;
+		double animationSeconds; // from Run until the replay caught up with the outcome
+	};
+
+	// a complete one directional run, only shown next to runs of the same query on the same grid
+	struct ExpansionCount {
+		uint64_t version = 0; // of m_snapshot, 0 is never a version
+		uint32_t source = GridModel::npos;
+		uint32_t target = GridModel::npos;
+		uint32_t expansions = GridModel::npos;
+	};
 
 public:
-	explicit GraphicsScene(QSize size);
+	constexpr static uint32_t defaultRowCnt = 10;
+	constexpr static uint32_t defaultColCnt = 20;
+
+	GraphicsScene(QSize size, uint32_t rowCnt, uint32_t colCnt);
 	GraphicsScene() = default;
 	GraphicsScene(const GraphicsScene & other) = delete;
 	GraphicsScene(GraphicsScene && other) = delete;
 	GraphicsScene & operator=(const GraphicsScene & other) = delete;
 	GraphicsScene & operator=(GraphicsScene && other) = delete;
 
+	// blocks and costs of grid, which has the dimensions of the scene. source and target move off blocks
+	void setGrid(const GridModel & grid) noexcept;
+
 private:
 	void populateBar() noexcept;
 	void populateWidget(QWidget * widget, const QString & algoName, const QString & infoText) noexcept;
 	void populateGridScene() noexcept;
 	void populateLegend(QWidget * parentWidget, QVBoxLayout * sideLayout) const noexcept;
-	void populateBottomLayout(QWidget * parentWidget, QGridLayout * mainLayout) const noexcept;
+	void populateHeuristicBox(QWidget * parentWidget) noexcept;
+	void populateBidirectionalBox(QWidget * parentWidget) noexcept;
+	void populateQueueBox(QWidget * parentWidget) noexcept;
+	void populateFieldBox(QWidget * parentWidget) noexcept;
+	void populateStatsPanel(QWidget * parentWidget, QVBoxLayout * sideLayout) noexcept;
+	void populateBottomLayout(QWidget * parentWidget, QGridLayout * mainLayout) noexcept;
 	void populateSideLayout(QWidget * parent, QVBoxLayout * sideLayout, const QString & algoName, const QString & infoText) noexcept;
 	void configureMachine(QWidget * parentWidget, QPushButton * statusButton) noexcept;
 	void setMainSceneConnections() const noexcept;
-	void connectPaths() const noexcept;
 	void configureInnerScene() noexcept;
 	void generateRandGridPattern() noexcept;
+	void noteEdit(uint32_t cell) noexcept;
+	void flushEdits() noexcept;
+	// reruns the finished D* Lite search on the edited grid, posted by noteEdit so a whole stroke or drop shares one run
+	void repairSearch() noexcept;
+	// brings m_snapshot up to m_grid by copying the cells edited since the last run, then refreshes m_components
+	void syncSnapshot() noexcept;
 	void allocDataStructures() noexcept;
 	void setRunning(bool newState) noexcept;
-	void dfsImplementation() noexcept;
-	void bfsImplementation() noexcept;
-	void dijkstraImplementation() noexcept;
-	void pathConnect() const noexcept;
+	void advanceFrame(qint64 now, qint64 delta) noexcept;
+	[[nodiscard]]
+	bool replayStep() noexcept;
+	[[nodiscard]]
+	bool pathStep() noexcept;
+	void finishReplay() noexcept;
+	void recordRun() noexcept;
+	void exportRuns() noexcept;
+	void saveMap() noexcept;
+	void loadMap() noexcept;
+	void seek(uint32_t position) noexcept;
+	void applyTraceState(uint32_t cell, uint32_t position, bool runAnimations) noexcept;
+	void restorePath() noexcept;
+	void syncTimeline() const noexcept;
+	void updateDistance() const noexcept;
+	void updateExpansions() const noexcept;
+	// expansions of the last one directional run of tab, GridModel::npos unless it searched the query of m_trace on its grid
+	[[nodiscard]]
+	uint32_t comparableExpansions(TabIndex tab) const noexcept;
 	[[nodiscard]]
 	bool isRunning() const noexcept;
 	void cleanup() const noexcept;
-	void resetGrid() const noexcept;
-	void updateSourceTargetNodes() const noexcept;
+	void resetGrid() noexcept;
 	[[nodiscard]]
-	Node * getNewNode(size_t row, size_t col) noexcept;
-	[[nodiscard]]
-	Node * getNodeAt(size_t row, size_t col) const noexcept;
+	std::unique_ptr<SearchSolver> makeSolver(TabIndex tabIndex, bool bidirectional) const noexcept;
 	[[nodiscard]]
 	QLineEdit * getStatusBar(uint32_t tabIndex) const noexcept;
 	[[nodiscard]]
-	bool isBlock(Node * currentNode) const noexcept;
-	[[nodiscard]]
-	bool isSpecial(Node * currentNode) const noexcept;
-	void setTimersIntervals(std::chrono::milliseconds newSpeed) const noexcept;
-	void memsetDs() const noexcept;
-	void stopTimers() const noexcept;
+	double stepsPerSecond(uint32_t sliderValue) const noexcept;
+	void memsetDs() noexcept;
+	void stopStepping() noexcept;
 	[[nodiscard]]
-	QHBoxLayout * getLegendLayout(QWidget * parentWidget, QString token) const noexcept;
+	QHBoxLayout * getLegendLayout(QWidget * parentWidget, const QString & token, GridItem::State state) const noexcept;
 	void disableBarTabs(int32_t exception) const noexcept;
 	void enableAllBarTabs() const noexcept;
-	void bfsStart(bool newStart) const noexcept;
-	void dfsStart(bool newStart) const noexcept;
-	void dijkstraStart(bool newStart) const noexcept;
+	void searchStart(bool newStart) noexcept;
 	static void addShadowEffect(QLabel * label) noexcept;
 	[[nodiscard]]
-	static bool validCordinate(ptrdiff_t row, ptrdiff_t col) noexcept;
+	uint32_t getRandomCell() noexcept;
 	[[nodiscard]]
-	static std::pair<size_t, size_t> getRandomCord() noexcept;
+	int32_t nodeSpacing() const noexcept;
 
 	///
 	constexpr static int32_t yOffset = -135;
-	constexpr static uint32_t rowCnt = 10;
-	constexpr static uint32_t colCnt = 20;
-	constexpr static uint32_t defaultDelay = 100;
-	constexpr static uint32_t maximumBlocks = 60;
-	constexpr static std::array<int32_t, 4> xCord{-1, 1, 0, 0};
-	constexpr static std::array<int32_t, 4> yCord{0, 0, 1, -1};
+	constexpr static std::array<const char *, heuristicCount> heuristicNames{"Manhattan", "Octile", "Euclidean", "Zero (Dijkstra)"};
+	constexpr static std::array<const char *, queueBackendCount> queueNames{"Binary heap", "4-ary heap (decrease-key)", "Dial buckets",
+												   "Radix heap"};
+	constexpr static uint32_t defaultSpeed = 500;	     // slider value, 0 - 1000
+	constexpr static qint64 maximumFrameDelta = 100; // ms, a stalled frame does not turn into a burst of steps
+	constexpr static double topSpeedMargin = 1.25;	     // full slider floods the whole grid in 1 / margin seconds
+	constexpr static size_t maximumDrain = 1 << 18;	     // worker events moved into m_trace per frame
+	constexpr static int32_t defaultSpacing = 25;
+	constexpr static double blockDensity = 0.3; // share of cells turned into blocks by the random pattern
 	inline static std::mt19937 generator = std::mt19937(std::random_device()());
-	inline static std::uniform_int_distribution rowRange = std::uniform_int_distribution<size_t>(0, rowCnt - 1);
-	inline static std::uniform_int_distribution colRange = std::uniform_int_distribution<size_t>(0, colCnt - 1);
-	inline static std::uniform_int_distribution binaryDist = std::uniform_int_distribution<uint8_t>(0, 1);
 
+	uint32_t m_rowCnt = defaultRowCnt;
+	uint32_t m_colCnt = defaultColCnt;
+	std::uniform_int_distribution<size_t> m_rowRange;
+	std::uniform_int_distribution<size_t> m_colRange;
 	bool m_running = false;
-	Node * m_sourceNode = nullptr;
-	Node * m_targetNode = nullptr;
-	uint32_t m_timerDelay = defaultDelay;
-	std::unique_ptr<QTimer> bfsTimer = std::make_unique<QTimer>();
-	std::unique_ptr<QTimer> dfsTimer = std::make_unique<QTimer>();
-	std::unique_ptr<QTimer> dijkstraTimer = std::make_unique<QTimer>();
-	std::unique_ptr<QTimer> pathTimer = std::make_unique<QTimer>();
-	std::unique_ptr<std::queue<std::pair<Node *, uint32_t>>> m_queue;
-	std::unique_ptr<std::stack<std::pair<Node *, uint32_t>>> m_stack;
-	std::unique_ptr<std::vector<std::vector<bool>>> m_visited;
-	std::unique_ptr<std::vector<std::vector<uint32_t>>> m_distance;
-	std::unique_ptr<std::priority_queue<pIntNode, std::vector<pIntNode>, std::greater<>>> m_priorityQueue;
+	Stepping m_stepping = Stepping::Idle;
+	double m_stepsPerSecond = 1;
+	double m_stepBudget = 0; // fractional steps carried over to the next frame
+	std::unique_ptr<GridModel> m_grid;
+	std::unique_ptr<GridModel> m_snapshot; // searched by m_worker, so edits to m_grid during a run never race with it
+	std::unique_ptr<ComponentIndex> m_components; // of m_snapshot, lets every solver turn down unreachable targets at once
+	std::vector<std::unique_ptr<SearchSolver>> m_solvers; // one per tab, reused between runs
+	std::vector<std::unique_ptr<SearchSolver>> m_bidirectionalSolvers; // per tab, nullptr where there is no such variant
+	std::unique_ptr<DistanceFieldSolver> m_fieldSolver; // Dijkstra tab with m_fieldBox checked, its field outlives the runs
+	SearchSolver * m_solver = nullptr;
+	SearchTrace m_trace;		 // the last search, recorded at full speed and replayed by the animation
+	TabIndex m_traceTab = TabIndex::Bfs; // algorithm that recorded m_trace
+	bool m_traceBidirectional = false;
+	bool m_traceField = false;
+	std::vector<ExpansionCount> m_oneWayExpansions; // per tab
+	Heuristic m_heuristic = Heuristic::Manhattan;
+	QueueBackend m_queueBackend = QueueBackend::BinaryHeap;	 // picked for the Dijkstra tab
+	QueueBackend m_solverQueueBackend = QueueBackend::BinaryHeap; // the one m_solvers[Dijkstra] runs on
+	std::vector<uint32_t> m_editedCells; // since the last HPA* or D* Lite run, which repair only around them. npos stands for all
+	std::vector<uint32_t> m_snapshotEdits; // since m_snapshot was synced, npos stands for all
+	uint64_t m_snapshotVersion = 0;	   // of m_grid when m_snapshot was synced, 0 is never a version
+	uint32_t m_replayPosition = 0; // steps of m_trace currently shown
+	bool m_reverse = false;
+	bool m_pathMarked = false;		 // some cells of m_trace.path() are shown as Inpath
+	std::vector<QSlider *> m_timelines; // one per tab
+	std::vector<QLabel *> m_expansionLabels; // one per tab
+	std::vector<QCheckBox *> m_bidirectionalBoxes; // per tab, nullptr where there is no such variant
+	QCheckBox * m_fieldBox = nullptr;
+	std::vector<QSpinBox *> m_brushBoxes; // one per tab, kept in sync
+	std::vector<QLabel *> m_statsLabels;	// one per tab, the last run finished there
+	std::vector<RunRecord> m_runs;		// every finished run, exported as JSON
+	QString m_traceVariant;			// heuristic or queue of the run that recorded m_trace
+	QElapsedTimer m_animationTimer;		// since the run of m_trace was started
+	bool m_runRecorded = true;
+	bool m_repairLive = false;   // the last run was D* Lite and finished, edits and dropped endpoints repair it on their own
+	bool m_repairQueued = false; // repairSearch is posted
+	SearchWorker m_worker;		// declared after the solvers it steps so it is joined first
+	std::vector<uint32_t> m_path; // cells still to be marked as Inpath, source at the back so it is marked first
 	QGraphicsScene * innerScene = new QGraphicsScene(this);
-	QGraphicsGridLayout * m_innerLayout;
+	AnimationClock * m_clock = new AnimationClock(this); // drives every cell tween of the scene
+	GridItem * m_gridItem = nullptr;
 	std::unique_ptr<QTabWidget> m_bar;
-	std::pair<size_t, size_t> m_sourceNodeCord;
-	std::pair<size_t, size_t> m_targetNodeCord;
 	QSize windowSize;
 	std::unique_ptr<StackedWidget> helpDialogWidget;
 
 public slots:
-	void setDelay(uint32_t newDelay) noexcept;
+	void setSpeed(uint32_t sliderValue) noexcept;
 signals:
 	void foundPath() const;
 	void close() const;
@@ -135,35 +222,37 @@ signals:
 	void animationDurationChanged(uint32_t newDuration) const;
 };
 
-inline GraphicsScene::GraphicsScene(const QSize size) : windowSize(size), helpDialogWidget(std::make_unique<StackedWidget>(windowSize)) {
+inline GraphicsScene::GraphicsScene(const QSize size, const uint32_t rowCnt, const uint32_t colCnt)
+    : m_rowCnt(rowCnt), m_colCnt(colCnt), m_rowRange(0, rowCnt - 1), m_colRange(0, colCnt - 1), windowSize(size),
+	helpDialogWidget(std::make_unique<StackedWidget>(windowSize)) {
+	assert(GridModel::validDimensions(rowCnt, colCnt));
 	populateBar();
-	setTimersIntervals(static_cast<std::chrono::milliseconds>(m_timerDelay));
 	configureInnerScene();
-	connectPaths();
+	setSpeed(defaultSpeed);
 	setMainSceneConnections();
 }
 
-inline void GraphicsScene::connectPaths() const noexcept {
-	connect(bfsTimer.get(), &QTimer::timeout, this, &GraphicsScene::bfsImplementation);
-	connect(dfsTimer.get(), &QTimer::timeout, this, &GraphicsScene::dfsImplementation);
-	connect(dijkstraTimer.get(), &QTimer::timeout, this, &GraphicsScene::dijkstraImplementation);
-	pathConnect();
-}
-
 inline void GraphicsScene::configureInnerScene() noexcept {
-	populateGridScene();
 	allocDataStructures();
+	populateGridScene();
 	memsetDs();
 }
 
 inline void GraphicsScene::setMainSceneConnections() const noexcept {
 	QTimer::singleShot(1009, helpDialogWidget.get(), &StackedWidget::show);
-	connect(this, &GraphicsScene::runningStatusChanged, &Node::setRunningState);
-	connect(this, SIGNAL(foundPath()), pathTimer.get(), SLOT(start()));
+	connect(this, &GraphicsScene::runningStatusChanged, m_gridItem, &GridItem::setRunningState);
+	connect(this, &GraphicsScene::animationDurationChanged, m_gridItem, &GridItem::changeAnimationDuration);
+	connect(m_clock, &AnimationClock::tick, this, &GraphicsScene::advanceFrame);
+}
+
+inline uint32_t GraphicsScene::getRandomCell() noexcept {
+	return m_grid->index(static_cast<uint32_t>(m_rowRange(generator)), static_cast<uint32_t>(m_colRange(generator)));
 }
 
-inline std::pair<size_t, size_t> GraphicsScene::getRandomCord() noexcept {
-	return std::make_pair(rowRange(generator), colRange(generator));
+inline int32_t GraphicsScene::nodeSpacing() const noexcept {
+	// keep the default look for the demo grid and pack nodes tighter as the grid widens
+	const uint32_t widest = std::max(m_colCnt, m_rowCnt * 2);
+	return widest <= defaultColCnt ? defaultSpacing : static_cast<int32_t>(defaultSpacing * defaultColCnt / widest);
 }
 
 inline void GraphicsScene::addShadowEffect(QLabel * label) noexcept {
@@ -191,35 +280,19 @@ inline bool GraphicsScene::isRunning() const noexcept {
 	return m_running;
 }
 
-inline void GraphicsScene::setDelay(const uint32_t newDelay) noexcept {
-	m_timerDelay = static_cast<uint32_t>(std::abs(static_cast<int64_t>(1000) - newDelay));
-	setTimersIntervals(static_cast<std::chrono::milliseconds>(m_timerDelay));
-}
-
-inline void GraphicsScene::setTimersIntervals(const std::chrono::milliseconds newDelay) const noexcept {
-	dfsTimer->setInterval(newDelay);
-	bfsTimer->setInterval(newDelay);
-	dijkstraTimer->setInterval(newDelay);
-	pathTimer->setInterval(newDelay);
+inline void GraphicsScene::setSpeed(const uint32_t sliderValue) noexcept {
+	m_stepsPerSecond = stepsPerSecond(sliderValue);
 }
 
-inline void GraphicsScene::stopTimers() const noexcept {
-	dfsTimer->stop();
-	bfsTimer->stop();
-	dijkstraTimer->stop();
-	pathTimer->stop();
+inline double GraphicsScene::stepsPerSecond(const uint32_t sliderValue) const noexcept {
+	// exponential so every slider notch feels alike, from one node per second up to the whole grid in under a second
+	const double topSpeed = std::max(1.0, topSpeedMargin * m_grid->cellCount());
+	return std::pow(topSpeed, std::min<uint32_t>(sliderValue, 1000) / 1000.0);
 }
 
-inline Node * GraphicsScene::getNodeAt(const size_t row, const size_t col) const noexcept {
-	if(auto * node = dynamic_cast<Node *>(m_innerLayout->itemAt(static_cast<int>(row), static_cast<int>(col)))) {
-		return node;
-	}
-
-	return nullptr;
-}
-
-inline bool GraphicsScene::validCordinate(const ptrdiff_t row, const ptrdiff_t col) noexcept {
-	return row >= 0 && static_cast<size_t>(row) < rowCnt && col >= 0 && static_cast<size_t>(col) < colCnt;
+inline void GraphicsScene::stopStepping() noexcept {
+	m_stepping = Stepping::Idle;
+	m_stepBudget = 0;
 }
 
 inline QLineEdit * GraphicsScene::getStatusBar(const uint32_t tabIndex) const noexcept {
@@ -228,47 +301,49 @@ inline QLineEdit * GraphicsScene::getStatusBar(const uint32_t tabIndex) const no
 	return static_cast<QLineEdit *>(static_cast<QHBoxLayout *>(abstractLayout)->itemAt(0)->widget());
 }
 
-inline bool GraphicsScene::isSpecial(Node * currentNode) const noexcept {
-	return currentNode == m_sourceNode || currentNode == m_targetNode;
-}
-
-inline void GraphicsScene::updateSourceTargetNodes() const noexcept {
-	assert(m_sourceNode && m_targetNode);
-
-	m_sourceNode->setType(Node::State::Source);
-	m_targetNode->setType(Node::State::Target);
-}
-
-inline bool GraphicsScene::isBlock(Node * currentNode) const noexcept {
-	return currentNode->getType() == Node::State::Block;
-}
-
-inline void GraphicsScene::bfsStart(const bool newStart) const noexcept {
+inline void GraphicsScene::searchStart(const bool newStart) noexcept {
 	if(newStart) {
-		m_queue->push({m_sourceNode, 0});
-		auto [startX, startY] = m_sourceNode->getCord();
-		(*m_visited)[startX][startY] = true;
-	}
-
-	bfsTimer->start();
-}
+		// the search runs on the worker at full speed, frames drain it into m_trace and the animation replays that
+		m_worker.cancel();
+		syncSnapshot();
+		const auto tabIndex = static_cast<size_t>(m_bar->currentIndex());
+		m_traceTab = static_cast<TabIndex>(tabIndex);
+		m_traceField = m_traceTab == TabIndex::Dijkstra && m_fieldBox->isChecked();
+		m_traceBidirectional = !m_traceField && m_bidirectionalBoxes[tabIndex] && m_bidirectionalBoxes[tabIndex]->isChecked();
+
+		if(m_traceTab == TabIndex::Dijkstra && m_queueBackend != m_solverQueueBackend) {
+			m_solverQueueBackend = m_queueBackend; // the worker is stopped, nothing steps the old solver anymore
+			m_solvers[tabIndex] = makeSolver(TabIndex::Dijkstra, false);
+		}
 
-inline void GraphicsScene::dfsStart(const bool newStart) const noexcept {
-	if(newStart) {
-		m_stack->push({m_sourceNode, 0});
-		auto [startX, startY] = m_sourceNode->getCord();
-		(*m_visited)[startX][startY] = true;
-	}
+		if(m_traceTab == TabIndex::Hpa || m_traceTab == TabIndex::DStarLite) {
+			flushEdits();
+		}
 
-	dfsTimer->start();
-}
+		m_solver = m_traceField ? m_fieldSolver.get() : (m_traceBidirectional ? m_bidirectionalSolvers : m_solvers)[tabIndex].get();
+		m_solver->setComponents(m_components.get());
+		m_traceVariant.clear();
+
+		if(m_traceTab == TabIndex::AStar) {
+			static_cast<AStarSolver *>(m_solver)->setHeuristic(m_heuristic);
+			m_traceVariant = heuristicNames[static_cast<size_t>(m_heuristic)];
+		} else if(m_traceField) {
+			m_traceVariant = "Distance field";
+		} else if(m_traceTab == TabIndex::Dijkstra && !m_traceBidirectional) {
+			m_traceVariant = queueNames[static_cast<size_t>(m_solverQueueBackend)];
+		}
 
-inline void GraphicsScene::dijkstraStart(const bool newStart) const noexcept {
-	if(newStart) {
-		m_priorityQueue->push({0, m_sourceNode});
-		auto [startX, startY] = m_sourceNode->getCord();
-		(*m_distance)[startX][startY] = 0;
+		m_trace.begin(*m_snapshot, m_gridItem->source(), m_gridItem->target());
+		m_worker.start(*m_solver, m_gridItem->source(), m_gridItem->target());
+		m_animationTimer.start();
+		m_runRecorded = false;
+		m_replayPosition = 0;
+		m_pathMarked = false;
+		m_path.clear();
+		syncTimeline();
 	}
 
-	dijkstraTimer->start();
+	m_stepping = Stepping::Replay;
+	m_stepBudget = 1; // show the first expansion right away rather than after a whole period
+	m_clock->requestFrame();
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QPixmap>
+#include <QRectF>
+#include <QColor>
+#include <array>
+#include "gridItem.h"
+
+// every cell sprite in all four rotations on one sheet, decoded once per process and shared by every grid item and the legend
+class SpriteAtlas {
+public:
+	constexpr static int32_t dimension = 32;
+	constexpr static int32_t rotationCount = 4;
+	// indexed by GridItem::rotationIndex
+	constexpr static std::array<qreal, rotationCount> rotations{0, 180, 90, 270};
+
+	SpriteAtlas(const SpriteAtlas & other) = delete;
+	SpriteAtlas(SpriteAtlas && other) = delete;
+	SpriteAtlas & operator=(const SpriteAtlas & other) = delete;
+	SpriteAtlas & operator=(SpriteAtlas && other) = delete;
+
+	// built lazily, needs a running QApplication
+	[[nodiscard]]
+	static const SpriteAtlas & instance() noexcept;
+
+	[[nodiscard]]
+	const QPixmap & sheet() const noexcept;
+	[[nodiscard]]
+	QRectF sourceRect(GridItem::State state, uint8_t rotation = 0) const noexcept;
+	[[nodiscard]]
+	QPixmap sprite(GridItem::State state) const noexcept;
+	// average sprite color, used when cells are too small on screen for icons
+	[[nodiscard]]
+	QRgb flatColor(GridItem::State state) const noexcept;
+
+private:
+	SpriteAtlas();
+
+	///
+	inline static const QColor jumpPointTint = QColor(255, 140, 0, 170);
+	QPixmap m_sheet;
+	std::array<QRgb, GridItem::stateCount> m_flatColors;
+};
+
+inline const SpriteAtlas & SpriteAtlas::instance() noexcept {
+	static const SpriteAtlas atlas;
+	return atlas;
+}
+
+inline const QPixmap & SpriteAtlas::sheet() const noexcept {
+	return m_sheet;
+}
+
+inline QRectF SpriteAtlas::sourceRect(const GridItem::State state, const uint8_t rotation) const noexcept {
+	return QRectF(rotation * dimension, static_cast<int32_t>(state) * dimension, dimension, dimension);
+}
+
+inline QPixmap SpriteAtlas::sprite(const GridItem::State state) const noexcept {
+	return m_sheet.copy(sourceRect(state).toAlignedRect());
+}
+
+inline QRgb SpriteAtlas::flatColor(const GridItem::State state) const noexcept {
+	return m_flatColors[static_cast<size_t>(state)];
+}
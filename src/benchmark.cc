@@ -0,0 +1,564 @@
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <array>
+#include "core/searchSolver.h"
+#include "core/bitboardBfs.h"
+#include "core/dStarLiteSolver.h"
+#include "core/deltaStepping.h"
+#include "core/gridFile.h"
+#include "core/hpaSolver.h"
+#include "core/parallelBfs.h"
+
+// headless throughput of every solver on generated and loaded maps, one JSON document on stdout:
+//   pathVisualizerBench [--cells n,n,...] [--map file [--scen file]] [--solvers name,name,...] [--density d] [--max-cost n] [--queries n]
+//                       [--seed n] [--threads n,n,...] [--delta n] [--tiled n] [--trace dir]
+// generated maps are near square grids of each --cells count, --map adds a .pvgrid or MovingAI .map file (see gridFile.h).
+// a --scen right after a --map runs the experiments of that MovingAI scenario on it instead of --queries random ones.
+// multi-threaded solvers run once per --threads count, speedup is against the first count for the same map.
+// --tiled moves every map to a temporary .pvtiles file and searches it from there with at most n tiles resident, the
+// multi-threaded solvers are skipped since a TiledStore is read from one thread only. a tile that cannot be mapped ends
+// the benchmark with failure, the runs of that map read made up cells. --trace saves the SearchTrace of the
+// first query of every solver built on SearchSolver as dir/<map>-<solver>.pvtrace, <map> counting from 0 in the order above.
+// every run is checked against BfsSolver or DijkstraSolver on the same queries, any disagreement fails the exit code
+struct BenchOptions {
+	std::vector<uint64_t> cellCounts;
+	std::vector<std::string> mapPaths;
+	std::vector<std::string> scenarioPaths; // one per --map, empty if no --scen followed it
+	std::vector<std::string> solverNames;
+	double density = 0.3;
+	uint32_t maxCost = GridModel::minimumCost; // open cells of generated maps get a uniform random cost up to this
+	uint32_t queryCnt = 16;
+	uint32_t seed = 1;
+	std::vector<size_t> threadCounts;
+	uint32_t delta = DeltaStepping::defaultDelta; // bucket width of delta-stepping
+	size_t residentTiles = 0;			   // of --tiled, 0 keeps the maps in memory
+	std::string traceDirectory;			   // of --trace, empty saves no traces
+};
+
+// a solver prepared on a map. run answers one query with the distance found or GridModel::npos and the counters of the
+// search, solvers built on SearchSolver log it into trace unless that is nullptr. path is the route of the last run to
+// target, source first, and empty for solvers that keep no parents
+struct QueryRunner {
+	std::function<uint32_t(uint32_t source, uint32_t target, SearchStats & stats, TraceRecorder * trace)> run;
+	std::function<std::vector<uint32_t>(uint32_t target)> path;
+};
+
+struct BenchSolver {
+	const char * name;
+	QueryRunner (*make)(const GridModel & grid, const BenchOptions & options, size_t threadCount);
+	bool threaded = false; // make honours threadCount, every other solver runs on one thread
+	bool weighted = false; // distances pay GridModel::cost(), checked against DijkstraSolver rather than BfsSolver
+	bool exact = true;     // shortest distances, otherwise only no shorter than the reference and found exactly when it is
+};
+
+struct BenchMap {
+	std::string name;
+	std::unique_ptr<GridModel> grid;
+	std::vector<std::pair<uint32_t, uint32_t>> queries; // of a scenario, random ones are drawn when empty
+};
+
+static QueryRunner runSolver(std::shared_ptr<SearchSolver> solver) {
+	const auto run = [solver](const uint32_t source, const uint32_t target, SearchStats & stats, TraceRecorder * const trace) {
+		solver->setTrace(trace);
+		solver->start(source, target);
+		solver->run();
+		stats = solver->stats();
+		return solver->status() == SearchSolver::Status::Found ? solver->currentDistance() : GridModel::npos;
+	};
+
+	return {run, [solver](uint32_t) { return solver->path(); }};
+}
+
+template<typename Solver>
+static QueryRunner runSolver(const GridModel & grid, const BenchOptions &, size_t) {
+	return runSolver(std::make_shared<Solver>(grid));
+}
+
+template<QueueBackend backend>
+static QueryRunner runDijkstra(const GridModel & grid, const BenchOptions &, size_t) {
+	return runSolver(makeDijkstraSolver(grid, backend));
+}
+
+static QueryRunner runBitboardBfs(const GridModel & grid, const BenchOptions &, size_t) {
+	const auto run = [bfs = std::make_shared<BitboardBfs>(grid)](const uint32_t source, const uint32_t target, SearchStats & stats,
+									   TraceRecorder *) {
+		const uint32_t distance = bfs->distance(source, target);
+		stats = bfs->stats();
+		return distance;
+	};
+
+	return {run, nullptr};
+}
+
+static QueryRunner runParallelBfs(const GridModel & grid, const BenchOptions &, const size_t threadCount) {
+	const auto bfs = std::make_shared<ParallelBfs>(grid, threadCount);
+	const auto run = [bfs](const uint32_t source, const uint32_t target, SearchStats & stats, TraceRecorder *) {
+		const uint32_t distance = bfs->run(source, target);
+		stats = bfs->stats();
+		return distance;
+	};
+
+	return {run, [bfs](const uint32_t target) { return bfs->path(target); }};
+}
+
+static QueryRunner runDeltaStepping(const GridModel & grid, const BenchOptions & options, const size_t threadCount) {
+	const auto sssp = std::make_shared<DeltaStepping>(grid, threadCount, options.delta);
+	const auto run = [sssp](const uint32_t source, const uint32_t target, SearchStats & stats, TraceRecorder *) {
+		const uint32_t distance = sssp->run(source, target);
+		stats = sssp->stats();
+		return distance;
+	};
+
+	return {run, [sssp](const uint32_t target) { return sssp->path(target); }};
+}
+
+// new solvers only need a line here
+static const std::array benchSolvers{
+	BenchSolver{"bfs", runSolver<BfsSolver>},
+	BenchSolver{"bfs-bitboard", runBitboardBfs},
+	BenchSolver{"bfs-parallel", runParallelBfs, true},
+	BenchSolver{"dfs", runSolver<DfsSolver>, false, false, false},
+	BenchSolver{"dijkstra", runDijkstra<QueueBackend::BinaryHeap>, false, true},
+	BenchSolver{"dijkstra-dary", runDijkstra<QueueBackend::DaryHeap>, false, true},
+	BenchSolver{"dijkstra-dial", runDijkstra<QueueBackend::Dial>, false, true},
+	BenchSolver{"dijkstra-radix", runDijkstra<QueueBackend::Radix>, false, true},
+	BenchSolver{"delta-stepping", runDeltaStepping, true, true},
+	BenchSolver{"bidirectional-bfs", runSolver<BidirectionalBfsSolver>},
+	BenchSolver{"bidirectional-dijkstra", runSolver<BidirectionalDijkstraSolver>, false, true},
+	BenchSolver{"astar", runSolver<AStarSolver>, false, true},
+	BenchSolver{"jps", runSolver<JpsSolver>},
+	BenchSolver{"hpa", runSolver<HpaSolver>, false, true, false},
+	BenchSolver{"dstar-lite", runSolver<DStarLiteSolver>, false, true},
+};
+
+static std::vector<std::string> splitList(const char * list) {
+	std::vector<std::string> items;
+	std::string item;
+
+	for(const char * character = list;; character++) {
+		if(*character == ',' || !*character) {
+			if(!item.empty()) {
+				items.push_back(item);
+			}
+
+			item.clear();
+
+			if(!*character) {
+				break;
+			}
+		} else {
+			item += *character;
+		}
+	}
+
+	return items;
+}
+
+static bool parseOptions(const int argc, char ** argv, BenchOptions & options) {
+	for(int index = 1; index + 1 < argc; index += 2) {
+		const char * flag = argv[index];
+		const char * value = argv[index + 1];
+
+		if(!std::strcmp(flag, "--cells")) {
+			for(const auto & item : splitList(value)) {
+				options.cellCounts.push_back(std::strtoull(item.c_str(), nullptr, 10));
+			}
+		} else if(!std::strcmp(flag, "--map")) {
+			options.mapPaths.push_back(value);
+			options.scenarioPaths.emplace_back();
+		} else if(!std::strcmp(flag, "--scen")) {
+			if(options.scenarioPaths.empty() || !options.scenarioPaths.back().empty()) {
+				return false;
+			}
+
+			options.scenarioPaths.back() = value;
+		} else if(!std::strcmp(flag, "--solvers")) {
+			options.solverNames = splitList(value);
+		} else if(!std::strcmp(flag, "--density")) {
+			options.density = std::strtod(value, nullptr);
+		} else if(!std::strcmp(flag, "--max-cost")) {
+			options.maxCost = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		} else if(!std::strcmp(flag, "--queries")) {
+			options.queryCnt = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		} else if(!std::strcmp(flag, "--seed")) {
+			options.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		} else if(!std::strcmp(flag, "--delta")) {
+			options.delta = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		} else if(!std::strcmp(flag, "--trace")) {
+			options.traceDirectory = value;
+		} else if(!std::strcmp(flag, "--tiled")) {
+			options.residentTiles = std::strtoull(value, nullptr, 10);
+
+			if(!options.residentTiles) {
+				return false;
+			}
+		} else if(!std::strcmp(flag, "--threads")) {
+			for(const auto & item : splitList(value)) {
+				options.threadCounts.push_back(std::strtoull(item.c_str(), nullptr, 10));
+			}
+		} else {
+			return false;
+		}
+	}
+
+	if(options.cellCounts.empty() && options.mapPaths.empty()) {
+		options.cellCounts = {1000, 10000, 100000, 1000000};
+	}
+
+	// powers of two up to the core count, and the core count itself
+	if(options.threadCounts.empty()) {
+		const size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+		for(size_t threadCount = 1; threadCount < cores; threadCount *= 2) {
+			options.threadCounts.push_back(threadCount);
+		}
+
+		options.threadCounts.push_back(cores);
+	}
+
+	if(options.solverNames.empty()) {
+		for(const auto & solver : benchSolvers) {
+			options.solverNames.push_back(solver.name);
+		}
+	}
+
+	const bool threadsValid = std::find(options.threadCounts.begin(), options.threadCounts.end(), 0) == options.threadCounts.end();
+	return argc % 2 == 1 && threadsValid && options.delta && options.queryCnt && options.maxCost >= GridModel::minimumCost && options.maxCost <= GridModel::maximumCost;
+}
+
+static const BenchSolver * findSolver(const std::string & name) noexcept {
+	for(const auto & solver : benchSolvers) {
+		if(name == solver.name) {
+			return &solver;
+		}
+	}
+
+	return nullptr;
+}
+
+static std::unique_ptr<GridModel> generateMap(const uint64_t cellCount, const BenchOptions & options, std::mt19937 & generator) {
+	const auto rowCnt = static_cast<uint32_t>(std::max<double>(1, std::floor(std::sqrt(static_cast<double>(cellCount)))));
+	const auto colCnt = static_cast<uint32_t>((cellCount + rowCnt - 1) / rowCnt);
+
+	if(!GridModel::validDimensions(rowCnt, colCnt)) {
+		return nullptr;
+	}
+
+	auto grid = std::make_unique<GridModel>(rowCnt, colCnt);
+	std::bernoulli_distribution blockDist(options.density);
+	std::uniform_int_distribution<uint32_t> costDist(GridModel::minimumCost, options.maxCost);
+
+	for(uint32_t cell = 0; cell < grid->cellCount(); cell++) {
+		grid->setBlock(cell, blockDist(generator));
+		grid->setCost(cell, static_cast<uint8_t>(costDist(generator)));
+	}
+
+	return grid;
+}
+
+// the same cells read through a TiledStore. the file is unlinked right away, the open store keeps it alive until the map goes
+static std::unique_ptr<GridModel> tileMap(const GridModel & grid, const BenchOptions & options) {
+	std::error_code error;
+	const auto path = std::filesystem::temp_directory_path(error) / ("pathVisualizerBench-" + std::to_string(getpid()) + ".pvtiles");
+
+	if(error || !saveTiledGrid(grid, path.string())) {
+		return nullptr;
+	}
+
+	auto tiled = openTiledGrid(path.string(), options.residentTiles);
+	std::filesystem::remove(path, error);
+	return tiled;
+}
+
+// distance of every query found by the sequential solver a BenchSolver is checked against
+static std::vector<uint32_t> referenceDistances(SearchSolver && solver, const std::vector<std::pair<uint32_t, uint32_t>> & queries) {
+	std::vector<uint32_t> distances;
+
+	for(const auto & [source, target] : queries) {
+		solver.start(source, target);
+		solver.run();
+		distances.push_back(solver.status() == SearchSolver::Status::Found ? solver.currentDistance() : GridModel::npos);
+	}
+
+	return distances;
+}
+
+// first query whose distance disagrees with reference, queries.size() if none does
+static size_t firstDisagreement(const BenchSolver & solver, const std::vector<uint32_t> & distances,
+				const std::vector<uint32_t> & reference) {
+	for(size_t query = 0; query < distances.size(); query++) {
+		const bool found = distances[query] != GridModel::npos;
+		const bool reachable = reference[query] != GridModel::npos;
+		const bool bounded = found == reachable && distances[query] >= reference[query];
+
+		if(solver.exact ? distances[query] != reference[query] : !bounded) {
+			return query;
+		}
+	}
+
+	return distances.size();
+}
+
+// a route between the endpoints over open neighbouring cells that costs distance, moves or GridModel::cost() of every cell
+// entered. no route at all when nothing was found
+static bool validPath(const GridModel & grid, const std::vector<uint32_t> & path, const uint32_t source, const uint32_t target,
+			    const uint32_t distance, const bool weighted) {
+	if(distance == GridModel::npos || path.empty()) {
+		return distance == GridModel::npos && path.empty();
+	}
+
+	uint64_t cost = 0;
+
+	for(size_t index = 1; index < path.size(); index++) {
+		const auto [row, col] = grid.getCord(path[index]);
+		const auto [previousRow, previousCol] = grid.getCord(path[index - 1]);
+		const uint32_t rowGap = std::max(row, previousRow) - std::min(row, previousRow);
+		const uint32_t colGap = std::max(col, previousCol) - std::min(col, previousCol);
+
+		if(path[index] >= grid.cellCount() || rowGap + colGap != 1 || grid.isBlock(path[index])) {
+			return false;
+		}
+
+		cost += weighted ? grid.cost(path[index]) : 1;
+	}
+
+	return path.front() == source && path.back() == target && cost == distance;
+}
+
+// recorded outside the timed runs, a trace costs a write per push and pop
+static bool saveTrace(const QueryRunner & query, const std::pair<uint32_t, uint32_t> & endpoints, const std::string & path) {
+	SearchTrace trace;
+	SearchStats stats;
+	query.run(endpoints.first, endpoints.second, stats, &trace);
+
+	if(!trace.complete()) {
+		return true; // not built on SearchSolver
+	}
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	return trace.write(file) && static_cast<bool>(file.flush());
+}
+
+// whole process high water mark, so it only grows from one run to the next
+static long peakRssKiB() noexcept {
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss; // KiB on Linux
+}
+
+static std::string escapeJson(const std::string & text) {
+	std::string escaped;
+
+	for(const char character : text) {
+		if(character == '"' || character == '\\') {
+			escaped += '\\';
+		}
+
+		escaped += character;
+	}
+
+	return escaped;
+}
+
+int main(int argc, char ** argv) {
+	BenchOptions options;
+
+	if(!parseOptions(argc, argv, options)) {
+		std::fprintf(stderr,
+			     "usage: %s [--cells n,n,...] [--map file [--scen file]] [--solvers name,name,...] [--density d] [--max-cost n] "
+			     "[--queries n] [--seed n] [--threads n,n,...] [--delta n] [--tiled n] [--trace dir]\n",
+			     argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<const BenchSolver *> solvers;
+
+	for(const auto & name : options.solverNames) {
+		const auto * solver = findSolver(name);
+
+		if(!solver) {
+			std::fprintf(stderr, "unknown solver %s\n", name.c_str());
+			return EXIT_FAILURE;
+		}
+
+		solvers.push_back(solver);
+	}
+
+	std::mt19937 generator(options.seed);
+	std::vector<BenchMap> maps;
+
+	for(const auto cellCount : options.cellCounts) {
+		auto grid = generateMap(cellCount, options, generator);
+
+		if(!grid) {
+			std::fprintf(stderr, "cannot generate a map of %llu cells\n", static_cast<unsigned long long>(cellCount));
+			return EXIT_FAILURE;
+		}
+
+		maps.push_back({"random-" + std::to_string(cellCount), std::move(grid), {}});
+	}
+
+	for(size_t index = 0; index < options.mapPaths.size(); index++) {
+		const auto & path = options.mapPaths[index];
+		const auto & scenarioPath = options.scenarioPaths[index];
+		BenchMap map{path, loadGrid(path), {}};
+
+		if(!map.grid) {
+			std::fprintf(stderr, "cannot load %s\n", path.c_str());
+			return EXIT_FAILURE;
+		}
+
+		if(!scenarioPath.empty() && !loadMovingAiScenario(scenarioPath, *map.grid, map.queries)) {
+			std::fprintf(stderr, "cannot load %s for %s\n", scenarioPath.c_str(), path.c_str());
+			return EXIT_FAILURE;
+		}
+
+		maps.push_back(std::move(map));
+	}
+
+	for(auto & map : maps) {
+		if(options.residentTiles && !(map.grid = tileMap(*map.grid, options))) {
+			std::fprintf(stderr, "cannot tile %s\n", map.name.c_str());
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::printf("{\n  \"seed\": %u,\n  \"queries\": %u,\n  \"runs\": [", options.seed, options.queryCnt);
+	bool firstRun = true;
+	bool allAgree = true;
+
+	for(size_t mapIndex = 0; mapIndex < maps.size(); mapIndex++) {
+		auto & [mapName, grid, queries] = maps[mapIndex];
+		// the same open endpoints for every solver of a map. maps without two open cells have nothing to search
+		std::uniform_int_distribution<uint32_t> cellDist(0, grid->cellCount() - 1);
+		const bool drawQueries = queries.empty();
+		const uint64_t attempts = 64ull * options.queryCnt + grid->cellCount();
+
+		for(uint64_t attempt = 0; drawQueries && queries.size() < options.queryCnt && attempt < attempts; attempt++) {
+			const uint32_t source = cellDist(generator);
+			const uint32_t target = cellDist(generator);
+
+			if(source != target && !grid->isBlock(source) && !grid->isBlock(target)) {
+				queries.push_back({source, target});
+			}
+		}
+
+		// what every run on the map is checked against, outside the timed runs
+		const auto moveDistances = referenceDistances(BfsSolver(*grid), queries);
+		const auto costDistances = referenceDistances(DijkstraSolver(*grid), queries);
+
+		for(const auto * benchSolver : solvers) {
+			if(benchSolver->threaded && grid->tiles()) {
+				continue;
+			}
+
+			const std::vector<size_t> threadCounts = benchSolver->threaded ? options.threadCounts : std::vector<size_t>{1};
+			double baseSeconds = 0;
+
+			for(const auto threadCount : threadCounts) {
+				const auto query = benchSolver->make(*grid, options, threadCount);
+				SearchStats total;
+				uint64_t distanceSum = 0;
+				uint32_t foundCnt = 0;
+				std::vector<uint32_t> distances;
+				std::vector<std::vector<uint32_t>> paths;
+				const std::string tracePath =
+				    options.traceDirectory + "/" + std::to_string(mapIndex) + "-" + benchSolver->name + ".pvtrace";
+
+				if(!options.traceDirectory.empty() && !queries.empty() && !saveTrace(query, queries.front(), tracePath)) {
+					std::fprintf(stderr, "cannot write %s\n", tracePath.c_str());
+					return EXIT_FAILURE;
+				}
+
+				const uint64_t tileLoadsBefore = grid->tiles() ? grid->tiles()->tileLoads() : 0;
+				double wallSeconds = 0;
+
+				for(const auto & [source, target] : queries) {
+					SearchStats stats;
+					const auto begin = std::chrono::steady_clock::now();
+					const uint32_t distance = query.run(source, target, stats, nullptr);
+					wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+					// read off the solver once the clock stopped, checked after the loop
+					if(query.path) {
+						paths.push_back(query.path(target));
+					}
+
+					total.expanded += stats.expanded;
+					total.pushed += stats.pushed;
+					total.stalePops += stats.stalePops;
+					total.peakFrontier = std::max(total.peakFrontier, stats.peakFrontier);
+					distances.push_back(distance);
+
+					if(distance != GridModel::npos) {
+						foundCnt++;
+						distanceSum += distance;
+					}
+				}
+
+				baseSeconds = baseSeconds > 0 ? baseSeconds : wallSeconds;
+				const uint64_t tileLoads = grid->tiles() ? grid->tiles()->tileLoads() - tileLoadsBefore : 0;
+
+				if(grid->failed()) {
+					std::fprintf(stderr, "cannot map a tile of %s, %s read cells that are not in the file\n", mapName.c_str(),
+						     benchSolver->name);
+					return EXIT_FAILURE;
+				}
+
+				const auto & reference = benchSolver->weighted ? costDistances : moveDistances;
+				const size_t disagreement = firstDisagreement(*benchSolver, distances, reference);
+				bool agrees = disagreement == queries.size();
+
+				if(!agrees) {
+					const auto [source, target] = queries[disagreement];
+					std::fprintf(stderr, "%s on %zu threads disagrees with %s on %s: %u to %u found %u instead of %u\n",
+						     benchSolver->name, threadCount, benchSolver->weighted ? "dijkstra" : "bfs", mapName.c_str(),
+						     source, target, distances[disagreement], reference[disagreement]);
+					allAgree = false;
+				}
+
+				for(size_t index = 0; index < paths.size(); index++) {
+					const auto [source, target] = queries[index];
+
+					if(!validPath(*grid, paths[index], source, target, distances[index], benchSolver->weighted)) {
+						std::fprintf(stderr, "%s on %zu threads returned a broken path on %s: %u to %u, %zu cells for %u\n",
+							     benchSolver->name, threadCount, mapName.c_str(), source, target, paths[index].size(),
+							     distances[index]);
+						agrees = allAgree = false;
+						break;
+					}
+				}
+
+				std::printf("%s\n    {\"map\": \"%s\", \"rows\": %u, \"cols\": %u, \"cells\": %u, \"solver\": \"%s\", \"queries\": %zu, \"found\": %u, "
+					    "\"distanceSum\": %llu, \"expanded\": %llu, \"pushed\": %llu, \"stalePops\": %llu, \"wallSeconds\": %.6f, "
+					    "\"nodesPerSecond\": %.0f, \"threads\": %zu, \"speedup\": %.3f, \"peakFrontier\": %zu, \"peakRssKiB\": %ld, "
+					    "\"tileLoads\": %llu, \"agrees\": %s}",
+					    firstRun ? "" : ",", escapeJson(mapName).c_str(), grid->rowCount(), grid->colCount(), grid->cellCount(), benchSolver->name,
+					    queries.size(), foundCnt, static_cast<unsigned long long>(distanceSum), static_cast<unsigned long long>(total.expanded),
+					    static_cast<unsigned long long>(total.pushed), static_cast<unsigned long long>(total.stalePops), wallSeconds,
+					    wallSeconds > 0 ? static_cast<double>(total.expanded) / wallSeconds : 0.0, threadCount,
+					    wallSeconds > 0 ? baseSeconds / wallSeconds : 1.0, total.peakFrontier, peakRssKiB(),
+					    static_cast<unsigned long long>(tileLoads), agrees ? "true" : "false");
+				std::fflush(stdout);
+				firstRun = false;
+			}
+		}
+	}
+
+	std::printf("\n  ]\n}\n");
+	return allAgree ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+#include <algorithm>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "core/bitboardBfs.h"
+
+BitboardBfs::BitboardBfs(const GridModel & grid)
+    : m_grid(grid), m_rowWords((grid.colCount() + wordBits - 1) / wordBits),
+	m_stride((m_rowWords + vectorWords - 1) / vectorWords * vectorWords + 2) {
+	const size_t words = (static_cast<size_t>(grid.rowCount()) + 2) * m_stride;
+	m_passable.assign(words, 0);
+	m_visited.assign(words, 0);
+	m_current.assign(words, 0);
+	m_next.assign(words, 0);
+	sync();
+}
+
+void BitboardBfs::sync() noexcept {
+	std::fill(m_passable.begin(), m_passable.end(), 0);
+
+	for(uint32_t row = 0; row < m_grid.rowCount(); row++) {
+		for(uint32_t col = 0; col < m_grid.colCount(); col++) {
+			if(!m_grid.isBlock(m_grid.index(row, col))) {
+				m_passable[wordIndex(row, col)] |= uint64_t{1} << (col % wordBits);
+			}
+		}
+	}
+}
+
+uint32_t BitboardBfs::distance(const uint32_t source, const uint32_t target) noexcept {
+	return flood(source, target);
+}
+
+uint64_t BitboardBfs::reachableCount(const uint32_t source) noexcept {
+	flood(source, GridModel::npos);
+	return m_stats.expanded;
+}
+
+uint32_t BitboardBfs::flood(const uint32_t source, const uint32_t target) noexcept {
+	m_stats = {};
+	std::fill(m_visited.begin(), m_visited.end(), 0);
+	std::fill(m_current.begin(), m_current.end(), 0);
+	std::fill(m_next.begin(), m_next.end(), 0);
+
+	const auto [sourceRow, sourceCol] = m_grid.getCord(source);
+
+	if(m_grid.isBlock(source)) {
+		return GridModel::npos;
+	}
+
+	const uint64_t sourceBit = uint64_t{1} << (sourceCol % wordBits);
+	m_current[wordIndex(sourceRow, sourceCol)] = sourceBit;
+	m_visited[wordIndex(sourceRow, sourceCol)] = sourceBit;
+	m_stats.expanded = m_stats.peakFrontier = 1;
+
+	if(source == target) {
+		return 0;
+	}
+
+	size_t targetWord = 0;
+	uint64_t targetBit = 0;
+
+	if(target != GridModel::npos) {
+		const auto [targetRow, targetCol] = m_grid.getCord(target);
+		targetWord = wordIndex(targetRow, targetCol);
+		targetBit = uint64_t{1} << (targetCol % wordBits);
+	}
+
+	// the frontier grows by at most one row each way per level, rows outside [rowBegin, rowEnd) of both buffers stay zero
+	size_t rowBegin = sourceRow;
+	size_t rowEnd = sourceRow + 1;
+
+	for(uint32_t level = 1;; level++) {
+		rowBegin = rowBegin ? rowBegin - 1 : 0;
+		rowEnd = std::min<size_t>(rowEnd + 1, m_grid.rowCount());
+
+		const uint64_t added = expandRows(rowBegin, rowEnd);
+
+		if(!added) {
+			return GridModel::npos;
+		}
+
+		m_stats.expanded += added;
+		m_stats.peakFrontier = std::max<size_t>(m_stats.peakFrontier, added);
+		std::swap(m_current, m_next);
+
+		if(m_current[targetWord] & targetBit) {
+			m_stats.pathLength = level;
+			return level;
+		}
+	}
+}
+
+#ifdef __AVX2__
+static uint64_t popcount256(const __m256i words) noexcept {
+	return static_cast<uint64_t>(__builtin_popcountll(static_cast<uint64_t>(_mm256_extract_epi64(words, 0))) +
+					     __builtin_popcountll(static_cast<uint64_t>(_mm256_extract_epi64(words, 1))) +
+					     __builtin_popcountll(static_cast<uint64_t>(_mm256_extract_epi64(words, 2))) +
+					     __builtin_popcountll(static_cast<uint64_t>(_mm256_extract_epi64(words, 3))));
+}
+#endif
+
+uint64_t BitboardBfs::expandRows(const size_t rowBegin, const size_t rowEnd) noexcept {
+	uint64_t added = 0;
+
+	for(size_t row = rowBegin; row < rowEnd; row++) {
+		const size_t base = (row + 1) * m_stride + 1;
+		const uint64_t * current = m_current.data() + base;
+		const uint64_t * above = current - m_stride;
+		const uint64_t * below = current + m_stride;
+		const uint64_t * passable = m_passable.data() + base;
+		uint64_t * visited = m_visited.data() + base;
+		uint64_t * next = m_next.data() + base;
+		size_t word = 0;
+
+#ifdef __AVX2__
+		// the guard words make current[-1] and current[m_rowWords] readable zeros, so carries between words are plain unaligned loads
+		for(; word + vectorWords <= m_stride - 2; word += vectorWords) {
+			const auto load = [](const uint64_t * address) {
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(address));
+			};
+
+			const __m256i middle = load(current + word);
+			const __m256i fromLeft = _mm256_or_si256(_mm256_slli_epi64(middle, 1), _mm256_srli_epi64(load(current + word - 1), 63));
+			const __m256i fromRight = _mm256_or_si256(_mm256_srli_epi64(middle, 1), _mm256_slli_epi64(load(current + word + 1), 63));
+			const __m256i vertical = _mm256_or_si256(load(above + word), load(below + word));
+			const __m256i reached = _mm256_or_si256(_mm256_or_si256(fromLeft, fromRight), vertical);
+			const __m256i visitedWords = load(visited + word);
+			const __m256i fresh = _mm256_andnot_si256(visitedWords, _mm256_and_si256(reached, load(passable + word)));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(next + word), fresh);
+
+			if(!_mm256_testz_si256(fresh, fresh)) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(visited + word), _mm256_or_si256(visitedWords, fresh));
+				added += popcount256(fresh);
+			}
+		}
+#endif
+
+		for(; word < m_rowWords; word++) {
+			const uint64_t middle = current[word];
+			const uint64_t fromLeft = middle << 1 | current[word - 1] >> 63;
+			const uint64_t fromRight = middle >> 1 | current[word + 1] << 63;
+			const uint64_t fresh = (fromLeft | fromRight | above[word] | below[word]) & passable[word] & ~visited[word];
+
+			next[word] = fresh;
+
+			// most words of a level are past or ahead of the wavefront, and popcount is a library call without hardware support
+			if(fresh) {
+				visited[word] |= fresh;
+				added += static_cast<uint64_t>(__builtin_popcountll(fresh));
+			}
+		}
+	}
+
+	return added;
+}
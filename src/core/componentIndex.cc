@@ -0,0 +1,191 @@
+#include <array>
+#include <algorithm>
+#include <utility>
+#include "core/componentIndex.h"
+
+void ComponentIndex::invalidate(const uint32_t cell) noexcept {
+	if(m_stale || m_rowCnt != m_grid.rowCount() || m_colCnt != m_grid.colCount()) {
+		return; // the next refresh rebuilds everything anyway
+	}
+
+	// past one edit per cell a rebuild is cheaper than the bookkeeping
+	if(m_edited.size() >= m_grid.cellCount()) {
+		invalidateAll();
+	} else {
+		m_edited.push_back(cell);
+	}
+}
+
+void ComponentIndex::refresh() noexcept {
+	if(m_rowCnt != m_grid.rowCount() || m_colCnt != m_grid.colCount()) {
+		m_stale = true;
+	}
+
+	for(const auto cell : m_edited) {
+		if(m_stale) {
+			break;
+		}
+
+		const bool nowOpen = !m_grid.isBlock(cell);
+
+		if(nowOpen != static_cast<bool>(m_open[cell])) {
+			nowOpen ? open(cell) : close(cell);
+		}
+	}
+
+	m_edited.clear();
+
+	if(m_stale) {
+		rebuild();
+	}
+}
+
+void ComponentIndex::rebuild() noexcept {
+	m_rowCnt = m_grid.rowCount();
+	m_colCnt = m_grid.colCount();
+	m_parent.assign(m_grid.cellCount(), GridModel::npos);
+	m_size.assign(m_grid.cellCount(), 1);
+	m_open.assign(m_grid.cellCount(), false);
+
+	// west and north are the neighbours already seen in row-major order
+	for(uint32_t cell = 0; cell < m_grid.cellCount(); cell++) {
+		if(m_grid.isBlock(cell)) {
+			continue;
+		}
+
+		m_open[cell] = true;
+		m_parent[cell] = cell;
+
+		if(cell % m_colCnt && m_open[cell - 1]) {
+			unite(cell, cell - 1);
+		}
+
+		if(cell >= m_colCnt && m_open[cell - m_colCnt]) {
+			unite(cell, cell - m_colCnt);
+		}
+	}
+
+	m_stale = false;
+	m_rebuilds++;
+}
+
+void ComponentIndex::open(const uint32_t cell) noexcept {
+	if(m_parent[cell] == GridModel::npos) {
+		m_parent[cell] = cell;
+		m_size[cell] = 1;
+	} else if(const uint32_t root = find(cell); m_size[root] > 1) {
+		// a link left by an earlier closure is still in the tree of its old component, only right if it rejoins that one
+		bool rejoins = false;
+
+		m_grid.forEachNeighbour(cell, [&](const uint32_t neighbour) {
+			rejoins = rejoins || (m_open[neighbour] && find(neighbour) == root);
+		});
+
+		if(!rejoins) {
+			m_stale = true;
+			return;
+		}
+	}
+
+	m_open[cell] = true;
+
+	m_grid.forEachNeighbour(cell, [this, cell](const uint32_t neighbour) {
+		if(m_open[neighbour]) {
+			unite(cell, neighbour);
+		}
+	});
+}
+
+void ComponentIndex::close(const uint32_t cell) noexcept {
+	m_open[cell] = false;
+
+	if(!ringConnected(cell) && !locallyConnected(cell)) {
+		m_stale = true;
+	}
+}
+
+bool ComponentIndex::ringConnected(const uint32_t cell) const noexcept {
+	// the surrounding cells clockwise from north, the neighbours at even positions
+	constexpr std::array<std::pair<int32_t, int32_t>, 8> ring{{{-1, 0}, {-1, 1}, {0, 1}, {1, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, -1}}};
+	const auto [row, col] = m_grid.getCord(cell);
+	std::array<bool, 8> openRing{};
+
+	for(size_t position = 0; position < ring.size(); position++) {
+		const auto ringRow = static_cast<ptrdiff_t>(row) + ring[position].first;
+		const auto ringCol = static_cast<ptrdiff_t>(col) + ring[position].second;
+		openRing[position] = m_grid.validCordinate(ringRow, ringCol) &&
+				     m_open[m_grid.index(static_cast<uint32_t>(ringRow), static_cast<uint32_t>(ringCol))];
+	}
+
+	// an open neighbour starts a new arc unless the corner and the neighbour before it are open as well
+	uint32_t arcs = 0;
+
+	for(size_t position = 0; position < ring.size(); position += 2) {
+		arcs += openRing[position] && !(openRing[(position + 7) % 8] && openRing[(position + 6) % 8]);
+	}
+
+	return arcs <= 1;
+}
+
+bool ComponentIndex::locallyConnected(const uint32_t cell) noexcept {
+	std::array<uint32_t, 4> neighbours{};
+	size_t neighbourCnt = 0;
+
+	m_grid.forEachNeighbour(cell, [&](const uint32_t neighbour) {
+		if(m_open[neighbour]) {
+			neighbours[neighbourCnt++] = neighbour;
+		}
+	});
+
+	size_t missing = neighbourCnt ? neighbourCnt - 1 : 0;
+	m_seen.resize(m_grid.cellCount());
+	m_localQueue.clear();
+
+	if(missing) {
+		m_seen.insert(neighbours[0]);
+		m_localQueue.push_back(neighbours[0]);
+	}
+
+	const auto others = neighbours.begin() + 1;
+	const auto end = neighbours.begin() + neighbourCnt;
+
+	for(size_t head = 0; missing && head < m_localQueue.size() && m_localQueue.size() < localBudget; head++) {
+		m_grid.forEachNeighbour(m_localQueue[head], [&](const uint32_t togo) {
+			if(!m_open[togo] || m_seen.contains(togo)) {
+				return;
+			}
+
+			m_seen.insert(togo);
+			m_localQueue.push_back(togo);
+			missing -= std::find(others, end, togo) != end;
+		});
+	}
+
+	return !missing;
+}
+
+uint32_t ComponentIndex::find(uint32_t cell) noexcept {
+	// path halving
+	while(m_parent[cell] != cell) {
+		m_parent[cell] = m_parent[m_parent[cell]];
+		cell = m_parent[cell];
+	}
+
+	return cell;
+}
+
+void ComponentIndex::unite(const uint32_t first, const uint32_t second) noexcept {
+	auto firstRoot = find(first);
+	auto secondRoot = find(second);
+
+	if(firstRoot == secondRoot) {
+		return;
+	}
+
+	if(m_size[firstRoot] < m_size[secondRoot]) {
+		std::swap(firstRoot, secondRoot);
+	}
+
+	m_parent[secondRoot] = firstRoot;
+	m_size[firstRoot] += m_size[secondRoot];
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include "core/dStarLiteSolver.h"
+
+void DStarLiteSolver::invalidate(const uint32_t cell) noexcept {
+	if(!m_editedAll) {
+		m_edited.push_back(cell);
+	}
+}
+
+void DStarLiteSolver::invalidateAll() noexcept {
+	m_editedAll = true;
+	m_edited.clear();
+}
+
+std::vector<uint32_t> DStarLiteSolver::path() const noexcept {
+	std::vector<uint32_t> cells;
+
+	if(m_status != Status::Found) {
+		return cells;
+	}
+
+	cells.push_back(m_source);
+
+	// downhill along cost + g, bounded in case an inconsistent cell off the final path would loop
+	for(uint32_t cell = m_source; cell != m_target; cells.push_back(cell)) {
+		cell = bestSuccessor(cell);
+
+		if(cell == GridModel::npos || cells.size() > m_grid.cellCount()) {
+			return {};
+		}
+	}
+
+	return cells;
+}
+
+void DStarLiteSolver::reset() noexcept {
+	m_done = false;
+	m_repaired = !m_editedAll && m_target == m_lastTarget && m_g.size() == m_grid.cellCount() && m_colCnt == m_grid.colCount();
+
+	if(!m_repaired) {
+		restart();
+	} else {
+		// every key already queued undershoots by the distance the source moved, which keeps them admissible
+		m_keyOffset += estimateDistance(Heuristic::Manhattan, m_grid, m_lastSource, m_source);
+
+		for(const auto cell : m_edited) {
+			updateCell(cell);
+			m_grid.forEachNeighbour(cell, [this](const uint32_t neighbour) { updateCell(neighbour); });
+		}
+	}
+
+	m_edited.clear();
+	m_editedAll = false;
+	m_lastSource = m_source;
+	m_lastTarget = m_target;
+	m_colCnt = m_grid.colCount();
+}
+
+bool DStarLiteSolver::expand() noexcept {
+	for(;;) {
+		if(finished()) {
+			if(m_g[m_source] == infinity) {
+				return false;
+			}
+
+			m_done = true;
+			m_current = m_source;
+			m_currentDistance = m_g[m_source];
+			return true;
+		}
+
+		std::pop_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+		const auto [key, cell] = m_openList.back();
+		m_openList.pop_back();
+		m_queued[cell] = false;
+
+		// queued before the source moved, so only requeued with the key it has now
+		if(const Key fresh = calculateKey(cell); key < fresh) {
+			m_queued[cell] = true;
+			m_queuedKey[cell] = fresh;
+			m_openList.push_back({fresh, cell});
+			std::push_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+			continue;
+		}
+
+		m_current = cell;
+
+		if(m_g[cell] > m_rhs[cell]) {
+			m_g[cell] = m_rhs[cell];
+			m_currentDistance = m_g[cell];
+		} else {
+			// a route got dearer or closed: forget g and let the neighbours that relied on it look again
+			m_g[cell] = infinity;
+			updateCell(cell);
+			m_currentDistance = m_rhs[cell] == infinity ? m_currentDistance : m_rhs[cell];
+		}
+
+		m_grid.forEachNeighbour(cell, [this](const uint32_t neighbour) { updateCell(neighbour); });
+		return true;
+	}
+}
+
+uint32_t DStarLiteSolver::currentParent() const noexcept {
+	return m_current == m_target ? GridModel::npos : bestSuccessor(m_current);
+}
+
+void DStarLiteSolver::restart() noexcept {
+	m_g.assign(m_grid.cellCount(), infinity);
+	m_rhs.assign(m_grid.cellCount(), infinity);
+	m_queuedKey.assign(m_grid.cellCount(), Key{});
+	m_queued.assign(m_grid.cellCount(), false);
+	m_openList.clear();
+	m_keyOffset = 0;
+
+	m_rhs[m_target] = 0;
+	m_queued[m_target] = true;
+	m_queuedKey[m_target] = calculateKey(m_target);
+	m_openList.push_back({m_queuedKey[m_target], m_target});
+	recordPush(m_target);
+}
+
+void DStarLiteSolver::updateCell(const uint32_t cell) noexcept {
+	if(cell != m_target) {
+		const uint32_t successor = m_grid.isBlock(cell) ? GridModel::npos : bestSuccessor(cell);
+		m_rhs[cell] = successor == GridModel::npos ? infinity : m_grid.cost(successor) + m_g[successor];
+	}
+
+	if(m_g[cell] == m_rhs[cell]) {
+		m_queued[cell] = false;
+		return;
+	}
+
+	m_queued[cell] = true;
+	m_queuedKey[cell] = calculateKey(cell);
+	m_openList.push_back({m_queuedKey[cell], cell});
+	std::push_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+	recordPush(cell);
+}
+
+uint32_t DStarLiteSolver::bestSuccessor(const uint32_t cell) const noexcept {
+	uint32_t best = GridModel::npos;
+	uint64_t bestCost = infinity;
+
+	m_grid.forEachNeighbour(cell, [&](const uint32_t neighbour) {
+		if(m_grid.isBlock(neighbour) || m_g[neighbour] == infinity) {
+			return;
+		}
+
+		const uint64_t cost = static_cast<uint64_t>(m_grid.cost(neighbour)) + m_g[neighbour];
+
+		if(cost < bestCost) {
+			best = neighbour;
+			bestCost = cost;
+		}
+	});
+
+	return best;
+}
+
+bool DStarLiteSolver::liveTop() noexcept {
+	while(!m_openList.empty() &&
+	      (!m_queued[m_openList.front().cell] || m_queuedKey[m_openList.front().cell] != m_openList.front().key)) {
+		std::pop_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+		m_openList.pop_back();
+		m_stats.stalePops++;
+	}
+
+	return !m_openList.empty();
+}
+
+DStarLiteSolver::Key DStarLiteSolver::calculateKey(const uint32_t cell) const noexcept {
+	const uint32_t value = std::min(m_g[cell], m_rhs[cell]);
+
+	if(value == infinity) {
+		return {UINT64_MAX, UINT64_MAX};
+	}
+
+	return {value + estimateDistance(Heuristic::Manhattan, m_grid, m_source, cell) + m_keyOffset, value};
+}
+
+bool DStarLiteSolver::finished() noexcept {
+	return !liveTop() || (m_openList.front().key >= calculateKey(m_source) && m_rhs[m_source] == m_g[m_source]);
+}
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include "core/deltaStepping.h"
+
+DeltaStepping::DeltaStepping(const GridModel & grid, const size_t threadCount, const uint32_t delta)
+    : m_grid(grid), m_delta(std::clamp<uint32_t>(delta, 1, GridModel::maximumCost)), m_bucketCount(GridModel::maximumCost / m_delta + 2),
+	m_pool(threadCount), m_lanes(m_pool.size()), m_label(grid.cellCount()), m_expandedAt(grid.cellCount()) {
+	for(auto & lane : m_lanes) {
+		lane.buckets.resize(m_bucketCount);
+	}
+}
+
+uint32_t DeltaStepping::run(const uint32_t source, const uint32_t target) noexcept {
+	m_stats = {};
+
+	const size_t cellCount = m_label.size();
+	const size_t share = (cellCount + m_pool.size() - 1) / m_pool.size();
+
+	m_pool.run([this, cellCount, share](const size_t index) {
+		const size_t end = std::min(cellCount, (index + 1) * share);
+
+		for(size_t cell = index * share; cell < end; cell++) {
+			m_label[cell].store(unreached, std::memory_order_relaxed);
+			m_expandedAt[cell].store(GridModel::npos, std::memory_order_relaxed);
+		}
+	});
+
+	for(auto & lane : m_lanes) {
+		for(auto & bucket : lane.buckets) {
+			bucket.clear();
+		}
+
+		lane.frontier.clear();
+		lane.settled.clear();
+		lane.stats = {};
+	}
+
+	if(m_grid.isBlock(source)) {
+		return GridModel::npos;
+	}
+
+	m_label[source].store(pack(0, GridModel::npos), std::memory_order_relaxed);
+	m_lanes.front().buckets.front().push_back(source);
+	m_stats.pushed = 1;
+
+	for(uint64_t bucket = 0; bucket != noBucket; bucket = nextBucket(bucket)) {
+		const size_t slot = bucket % m_bucketCount;
+
+		// light moves may land back in this bucket, so it is emptied phase by phase
+		for(;;) {
+			size_t phaseSize = 0;
+
+			for(auto & lane : m_lanes) {
+				lane.frontier.clear();
+				std::swap(lane.frontier, lane.buckets[slot]);
+				phaseSize += lane.frontier.size();
+			}
+
+			if(!phaseSize) {
+				break;
+			}
+
+			m_stats.peakFrontier = std::max(m_stats.peakFrontier, phaseSize);
+
+			forEachChunk(&Lane::frontier, [this, bucket](Lane & own, const std::vector<uint32_t> & cells, const size_t begin, const size_t end) {
+				expandLight(own, cells, begin, end, bucket);
+			});
+		}
+
+		// every distance in the bucket is final now, heavy moves leave it for good
+		if(m_delta < GridModel::maximumCost) {
+			forEachChunk(&Lane::settled, [this](Lane & own, const std::vector<uint32_t> & cells, const size_t begin, const size_t end) {
+				expandHeavy(own, cells, begin, end);
+			});
+		}
+
+		for(auto & lane : m_lanes) {
+			lane.settled.clear();
+		}
+
+		if(target != GridModel::npos && distance(target) != GridModel::npos && distance(target) / m_delta <= bucket) {
+			break;
+		}
+	}
+
+	for(const auto & lane : m_lanes) {
+		m_stats.expanded += lane.stats.expanded;
+		m_stats.pushed += lane.stats.pushed;
+		m_stats.stalePops += lane.stats.stalePops;
+	}
+
+	if(target == GridModel::npos || distance(target) == GridModel::npos) {
+		return GridModel::npos;
+	}
+
+	m_stats.pathLength = static_cast<uint32_t>(path(target).size() - 1);
+	m_stats.pathCost = distance(target);
+	return distance(target);
+}
+
+std::vector<uint32_t> DeltaStepping::path(const uint32_t cell) const {
+	std::vector<uint32_t> cells;
+
+	if(distance(cell) == GridModel::npos) {
+		return cells;
+	}
+
+	// cut like ParallelBfs::path, a cycle of parents shows as a path not from the source
+	for(uint32_t current = cell; current != GridModel::npos && cells.size() <= m_grid.cellCount(); current = parent(current)) {
+		cells.push_back(current);
+	}
+
+	std::reverse(cells.begin(), cells.end());
+	return cells;
+}
+
+template<typename Pass>
+void DeltaStepping::forEachChunk(std::vector<uint32_t> Lane::*list, Pass && pass) noexcept {
+	size_t total = 0;
+
+	for(auto & lane : m_lanes) {
+		lane.cursor.store(0, std::memory_order_relaxed);
+		total += (lane.*list).size();
+	}
+
+	// a thread drains its own list first and then steals chunks of the others
+	const auto task = [this, list, &pass](const size_t index) {
+		Lane & own = m_lanes[index];
+		const size_t laneCount = m_lanes.size();
+
+		for(size_t offset = 0; offset < laneCount; offset++) {
+			Lane & victim = m_lanes[(index + offset) % laneCount];
+			const std::vector<uint32_t> & cells = victim.*list;
+
+			for(;;) {
+				const size_t begin = victim.cursor.fetch_add(chunkSize, std::memory_order_relaxed);
+
+				if(begin >= cells.size()) {
+					break;
+				}
+
+				pass(own, cells, begin, std::min(cells.size(), begin + chunkSize));
+			}
+		}
+	};
+
+	if(total < parallelThreshold) {
+		task(0);
+	} else {
+		m_pool.run(task);
+	}
+}
+
+void DeltaStepping::expandLight(Lane & own, const std::vector<uint32_t> & cells, const size_t begin, const size_t end,
+				const uint64_t bucket) noexcept {
+	for(size_t position = begin; position < end; position++) {
+		const uint32_t cell = cells[position];
+		const uint32_t cellDistance = distance(cell);
+
+		// a cell is queued once per improvement, only the entry matching its distance is expanded and only once
+		if(cellDistance / m_delta != bucket || m_expandedAt[cell].exchange(cellDistance, std::memory_order_relaxed) == cellDistance) {
+			own.stats.stalePops++;
+			continue;
+		}
+
+		own.stats.expanded++;
+		own.settled.push_back(cell);
+
+		m_grid.forEachNeighbour(cell, [&](const uint32_t togo) {
+			if(!m_grid.isBlock(togo) && m_grid.cost(togo) <= m_delta) {
+				relax(own, cell, togo, cellDistance + m_grid.cost(togo));
+			}
+		});
+	}
+}
+
+void DeltaStepping::expandHeavy(Lane & own, const std::vector<uint32_t> & cells, const size_t begin, const size_t end) noexcept {
+	for(size_t position = begin; position < end; position++) {
+		const uint32_t cell = cells[position];
+		const uint32_t cellDistance = distance(cell);
+
+		m_grid.forEachNeighbour(cell, [&](const uint32_t togo) {
+			if(!m_grid.isBlock(togo) && m_grid.cost(togo) > m_delta) {
+				relax(own, cell, togo, cellDistance + m_grid.cost(togo));
+			}
+		});
+	}
+}
+
+void DeltaStepping::relax(Lane & own, const uint32_t from, const uint32_t togo, const uint32_t distance) noexcept {
+	std::atomic<uint64_t> & label = m_label[togo];
+	uint64_t current = label.load(std::memory_order_relaxed);
+
+	// compared on the distance half only, an equal distance through another parent is no improvement
+	while(distance < current >> 32) {
+		if(label.compare_exchange_weak(current, pack(distance, from), std::memory_order_relaxed)) {
+			own.buckets[distance / m_delta % m_bucketCount].push_back(togo);
+			own.stats.pushed++;
+			return;
+		}
+	}
+}
+
+uint64_t DeltaStepping::nextBucket(const uint64_t bucket) const noexcept {
+	for(uint64_t next = bucket + 1; next < bucket + m_bucketCount; next++) {
+		for(const auto & lane : m_lanes) {
+			if(!lane.buckets[next % m_bucketCount].empty()) {
+				return next;
+			}
+		}
+	}
+
+	return noBucket;
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include "core/distanceFieldSolver.h"
+
+std::vector<uint32_t> DistanceFieldSolver::path() const noexcept {
+	std::vector<uint32_t> cells;
+
+	if(m_status != Status::Found) {
+		return cells;
+	}
+
+	for(uint32_t cell = m_target; cell != GridModel::npos; cell = m_parent[cell]) {
+		cells.push_back(cell);
+	}
+
+	std::reverse(cells.begin(), cells.end());
+	return cells;
+}
+
+void DistanceFieldSolver::reset() noexcept {
+	m_done = false;
+	m_cached = m_complete && m_fieldSource == m_source && m_fieldVersion == m_grid.version();
+
+	if(m_cached) {
+		return;
+	}
+
+	// a run stopped halfway leaves m_complete false as well, so its partial field is never trusted
+	m_complete = false;
+	m_distance.assign(m_grid.cellCount(), GridModel::npos);
+	m_parent.assign(m_grid.cellCount(), GridModel::npos);
+	m_priorityQueue.reset(m_grid.cellCount());
+	m_priorityQueue.push(0, m_source);
+	m_distance[m_source] = 0;
+	recordPush(m_source);
+}
+
+bool DistanceFieldSolver::expand() noexcept {
+	while(!m_complete) {
+		if(m_priorityQueue.empty()) {
+			m_complete = true;
+			m_fieldSource = m_source;
+			m_fieldVersion = m_grid.version();
+			break;
+		}
+
+		const auto [currentDistance, currentCell] = m_priorityQueue.pop();
+
+		if(m_distance[currentCell] != currentDistance) {
+			m_stats.stalePops++;
+			continue;
+		}
+
+		// no early exit at the target, later targets are read from the same field
+		m_grid.forEachNeighbour(currentCell, [this, currentCell, currentDistance](const uint32_t togoCell) {
+			if(m_grid.isBlock(togoCell)) {
+				return;
+			}
+
+			const auto newDistance = currentDistance + m_grid.cost(togoCell);
+
+			if(newDistance < m_distance[togoCell]) {
+				m_distance[togoCell] = newDistance;
+				m_parent[togoCell] = currentCell;
+				m_priorityQueue.push(newDistance, togoCell);
+				recordPush(togoCell);
+			}
+		});
+
+		m_current = currentCell;
+		m_currentDistance = currentDistance;
+		return true;
+	}
+
+	// the field is final, the last step reports the target once
+	if(m_distance[m_target] == GridModel::npos) {
+		return false;
+	}
+
+	m_done = true;
+	m_current = m_target;
+	m_currentDistance = m_distance[m_target];
+	return true;
+}
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include "core/gridFile.h"
+#include "core/mappedFile.h"
+
+struct GridFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t rowCnt;
+	uint32_t colCnt;
+	uint32_t flags;
+	uint32_t reserved;
+};
+
+static_assert(sizeof(GridFileHeader) % sizeof(uint64_t) == 0, "the block words follow the header aligned");
+
+constexpr static uint32_t gridMagic = 0x44475650; // "PVGD"
+constexpr static uint32_t gridVersion = 1;
+constexpr static uint32_t weightedFlag = 1; // a cost section follows the blocks
+
+static size_t blockWordCount(const uint64_t cellCnt) noexcept {
+	return static_cast<size_t>((cellCnt + 63) / 64);
+}
+
+static std::unique_ptr<GridModel> loadNativeGrid(const MappedFile & file) noexcept {
+	GridFileHeader header{};
+	std::memcpy(&header, file.data(), sizeof(header));
+
+	if(header.version != gridVersion || header.flags & ~weightedFlag || !GridModel::validDimensions(header.rowCnt, header.colCnt)) {
+		return nullptr;
+	}
+
+	const uint64_t cellCnt = static_cast<uint64_t>(header.rowCnt) * header.colCnt;
+	const size_t blockBytes = blockWordCount(cellCnt) * sizeof(uint64_t);
+	const size_t costBytes = header.flags & weightedFlag ? static_cast<size_t>(cellCnt) : 0;
+
+	if(file.size() != sizeof(header) + blockBytes + costBytes) {
+		return nullptr;
+	}
+
+	auto grid = std::make_unique<GridModel>(header.rowCnt, header.colCnt);
+	grid->assignBlocks(reinterpret_cast<const uint64_t *>(file.data() + sizeof(header)));
+
+	if(costBytes) {
+		grid->assignCosts(file.data() + sizeof(header) + blockBytes);
+	}
+
+	return grid;
+}
+
+static std::unique_ptr<GridModel> loadTiledGrid(const std::string & path) noexcept {
+	const auto tiles = TiledStore::open(path);
+
+	if(!tiles) {
+		return nullptr;
+	}
+
+	// one pass in row-major order, each tile row stays resident while its cells are copied
+	const GridModel tiled(tiles);
+	std::vector<uint64_t> words(blockWordCount(tiled.cellCount()));
+	std::vector<uint8_t> costs(tiled.cellCount());
+
+	for(uint32_t cell = 0; cell < tiled.cellCount(); cell++) {
+		words[cell / 64] |= static_cast<uint64_t>(tiled.isBlock(cell)) << cell % 64;
+		costs[cell] = tiled.cost(cell);
+	}
+
+	if(tiled.failed()) {
+		return nullptr;
+	}
+
+	auto grid = std::make_unique<GridModel>(tiled.rowCount(), tiled.colCount());
+	grid->assignBlocks(words.data());
+	grid->assignCosts(costs.data());
+	return grid;
+}
+
+static bool parseDimension(const std::string_view line, const std::string_view key, uint32_t & value) noexcept {
+	if(line.compare(0, key.size(), key)) {
+		return false;
+	}
+
+	value = static_cast<uint32_t>(std::strtoul(std::string(line.substr(key.size())).c_str(), nullptr, 10));
+	return true;
+}
+
+static std::unique_ptr<GridModel> parseMovingAiMap(const MappedFile & file) noexcept {
+	const std::string_view text(reinterpret_cast<const char *>(file.data()), file.size());
+	std::vector<std::string_view> rows;
+	uint32_t height = 0;
+	uint32_t width = 0;
+
+	for(size_t begin = 0; begin < text.size();) {
+		const size_t end = std::min(text.find('\n', begin), text.size());
+		std::string_view line = text.substr(begin, end - begin);
+		begin = end + 1;
+
+		if(!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1);
+		}
+
+		const bool dimension = parseDimension(line, "height", height) || parseDimension(line, "width", width);
+		const bool header = dimension || !line.compare(0, 4, "type") || line == "map";
+
+		if(!header && !line.empty()) {
+			rows.push_back(line);
+		}
+	}
+
+	const auto rowCnt = static_cast<uint32_t>(rows.size());
+	const auto colCnt = static_cast<uint32_t>(rows.empty() ? 0 : rows.front().size());
+
+	if(!GridModel::validDimensions(rowCnt, colCnt) || (height && height != rowCnt) || (width && width != colCnt)) {
+		return nullptr;
+	}
+
+	std::vector<uint64_t> words(blockWordCount(static_cast<uint64_t>(rowCnt) * colCnt));
+
+	for(uint32_t row = 0; row < rowCnt; row++) {
+		if(rows[row].size() != colCnt) {
+			return nullptr;
+		}
+
+		for(uint32_t col = 0; col < colCnt; col++) {
+			const char tile = rows[row][col];
+			const size_t cell = static_cast<size_t>(row) * colCnt + col;
+			words[cell / 64] |= static_cast<uint64_t>(tile != '.' && tile != 'G' && tile != 'S') << cell % 64;
+		}
+	}
+
+	auto grid = std::make_unique<GridModel>(rowCnt, colCnt);
+	grid->assignBlocks(words.data());
+	return grid;
+}
+
+std::unique_ptr<GridModel> loadGrid(const std::string & path) noexcept {
+	MappedFile file;
+
+	if(!file.open(path)) {
+		return nullptr;
+	}
+
+	if(TiledStore::isTiledFile(file.data(), file.size())) {
+		return loadTiledGrid(path);
+	}
+
+	uint32_t magic = 0;
+
+	if(file.size() >= sizeof(GridFileHeader)) {
+		std::memcpy(&magic, file.data(), sizeof(magic));
+	}
+
+	return magic == gridMagic ? loadNativeGrid(file) : parseMovingAiMap(file);
+}
+
+std::unique_ptr<GridModel> openTiledGrid(const std::string & path, const size_t residentLimit) noexcept {
+	auto tiles = TiledStore::open(path, residentLimit);
+	return tiles ? std::make_unique<GridModel>(std::move(tiles)) : nullptr;
+}
+
+bool saveTiledGrid(const GridModel & grid, const std::string & path) noexcept {
+	return TiledStore::write(grid, path);
+}
+
+bool saveGrid(const GridModel & grid, const std::string & path) noexcept {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	std::vector<uint64_t> words(blockWordCount(grid.cellCount()));
+	std::vector<uint8_t> costs(grid.cellCount());
+	bool weighted = false;
+
+	for(uint32_t cell = 0; cell < grid.cellCount(); cell++) {
+		words[cell / 64] |= static_cast<uint64_t>(grid.isBlock(cell)) << cell % 64;
+		costs[cell] = grid.cost(cell);
+		weighted = weighted || costs[cell] != GridModel::minimumCost;
+	}
+
+	if(grid.failed()) {
+		return false;
+	}
+
+	const GridFileHeader header{gridMagic, gridVersion, grid.rowCount(), grid.colCount(), weighted ? weightedFlag : 0, 0};
+	file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char *>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(uint64_t)));
+
+	if(weighted) {
+		file.write(reinterpret_cast<const char *>(costs.data()), static_cast<std::streamsize>(costs.size()));
+	}
+
+	return static_cast<bool>(file);
+}
+
+std::unique_ptr<GridModel> loadMovingAiMap(const std::string & path) noexcept {
+	MappedFile file;
+	return file.open(path) ? parseMovingAiMap(file) : nullptr;
+}
+
+bool loadMovingAiScenario(const std::string & path, const GridModel & grid, std::vector<std::pair<uint32_t, uint32_t>> & queries) noexcept {
+	std::ifstream file(path);
+	queries.clear();
+
+	if(!file) {
+		return false;
+	}
+
+	for(std::string line; std::getline(file, line);) {
+		if(!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+
+		if(line.empty() || !line.rfind("version", 0)) {
+			continue;
+		}
+
+		// bucket, map, width, height, start x, start y, goal x, goal y, optimal length
+		std::istringstream fields(line);
+		std::string mapName;
+		uint32_t bucket = 0;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t startX = 0;
+		uint32_t startY = 0;
+		uint32_t goalX = 0;
+		uint32_t goalY = 0;
+		double optimal = 0;
+
+		fields >> bucket >> mapName >> width >> height >> startX >> startY >> goalX >> goalY >> optimal;
+		const bool parsed = !fields.fail();
+
+		if(!parsed || width != grid.colCount() || height != grid.rowCount() || startX >= width || goalX >= width || startY >= height ||
+		   goalY >= height) {
+			queries.clear();
+			return false;
+		}
+
+		const uint32_t source = grid.index(startY, startX);
+		const uint32_t target = grid.index(goalY, goalX);
+
+		if(!grid.isBlock(source) && !grid.isBlock(target)) {
+			queries.push_back({source, target});
+		}
+	}
+
+	return true;
+}
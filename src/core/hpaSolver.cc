@@ -0,0 +1,378 @@
+#include <algorithm>
+#include "core/hpaSolver.h"
+
+HpaSolver::HpaSolver(const GridModel & grid, const uint32_t clusterSize) : AStarSolver(grid), m_clusterSize(std::max<uint32_t>(clusterSize, 2)) {
+}
+
+void HpaSolver::invalidate(const uint32_t cell) noexcept {
+	if(m_allDirty || m_rowCnt != m_grid.rowCount() || m_colCnt != m_grid.colCount()) {
+		return; // the next refresh rebuilds everything anyway
+	}
+
+	const uint32_t cluster = clusterOf(cell);
+
+	if(!m_dirty[cluster]) {
+		m_dirty[cluster] = true;
+		m_dirtyList.push_back(cluster);
+	}
+}
+
+void HpaSolver::invalidateAll() noexcept {
+	m_allDirty = true;
+}
+
+std::vector<uint32_t> HpaSolver::path() const noexcept {
+	return m_status == Status::Found ? m_path : std::vector<uint32_t>{};
+}
+
+void HpaSolver::reset() noexcept {
+	refresh();
+	m_sourceLinks.clear();
+	m_path.clear();
+
+	// costs on to the target first, the local search scratch is reused for the source right after
+	const Cluster & targetCluster = m_clusters[clusterOf(m_target)];
+	m_targetCosts.assign(targetCluster.nodes.size(), UINT32_MAX);
+
+	if(!m_grid.isBlock(m_target)) {
+		localSearch(targetCluster, m_target, true);
+
+		for(size_t node = 0; node < targetCluster.nodes.size(); node++) {
+			m_targetCosts[node] = m_localDistance[localIndex(targetCluster, targetCluster.nodes[node].cell)];
+		}
+	}
+
+	const Cluster & sourceCluster = m_clusters[clusterOf(m_source)];
+	localSearch(sourceCluster, m_source, false);
+
+	for(const auto & node : sourceCluster.nodes) {
+		const uint32_t cost = m_localDistance[localIndex(sourceCluster, node.cell)];
+
+		if(cost != UINT32_MAX && node.cell != m_source) {
+			m_sourceLinks.push_back({node.cell, cost});
+		}
+	}
+
+	if(&sourceCluster == &targetCluster && !m_grid.isBlock(m_target)) {
+		const uint32_t cost = m_localDistance[localIndex(sourceCluster, m_target)];
+
+		if(cost != UINT32_MAX) {
+			m_sourceLinks.push_back({m_target, cost});
+		}
+	}
+
+	AStarSolver::reset();
+}
+
+bool HpaSolver::expand() noexcept {
+	if(!popOpen()) {
+		return false;
+	}
+
+	if(m_current == m_target) {
+		refinePath();
+		return true;
+	}
+
+	if(m_current == m_source) {
+		for(const auto & [cell, cost] : m_sourceLinks) {
+			relax(cell, m_currentDistance + cost, m_current);
+		}
+
+		// a source on a border still has its crossings to take
+		if(m_slot[m_current] == GridModel::npos) {
+			return true;
+		}
+	}
+
+	const uint32_t clusterIndex = clusterOf(m_current);
+	const Cluster & cluster = m_clusters[clusterIndex];
+	const uint32_t slot = m_slot[m_current];
+	const size_t nodeCount = cluster.nodes.size();
+
+	for(size_t node = 0; node < nodeCount; node++) {
+		const uint32_t cost = cluster.distance[slot * nodeCount + node];
+
+		if(node != slot && cost != UINT32_MAX) {
+			relax(cluster.nodes[node].cell, m_currentDistance + cost, m_current);
+		}
+	}
+
+	for(const auto across : cluster.nodes[slot].across) {
+		if(across != GridModel::npos) {
+			relax(across, m_currentDistance + m_grid.cost(across), m_current);
+		}
+	}
+
+	if(clusterIndex == clusterOf(m_target) && m_targetCosts[slot] != UINT32_MAX) {
+		relax(m_target, m_currentDistance + m_targetCosts[slot], m_current);
+	}
+
+	return true;
+}
+
+void HpaSolver::refresh() noexcept {
+	if(m_rowCnt != m_grid.rowCount() || m_colCnt != m_grid.colCount()) {
+		m_rowCnt = m_grid.rowCount();
+		m_colCnt = m_grid.colCount();
+		m_clusterRows = (m_rowCnt + m_clusterSize - 1) / m_clusterSize;
+		m_clusterCols = (m_colCnt + m_clusterSize - 1) / m_clusterSize;
+		m_clusters.assign(static_cast<size_t>(m_clusterRows) * m_clusterCols, Cluster{});
+
+		for(uint32_t clusterRow = 0; clusterRow < m_clusterRows; clusterRow++) {
+			for(uint32_t clusterCol = 0; clusterCol < m_clusterCols; clusterCol++) {
+				auto & cluster = m_clusters[clusterRow * m_clusterCols + clusterCol];
+				cluster.rowBegin = clusterRow * m_clusterSize;
+				cluster.rowEnd = std::min(cluster.rowBegin + m_clusterSize, m_rowCnt);
+				cluster.colBegin = clusterCol * m_clusterSize;
+				cluster.colEnd = std::min(cluster.colBegin + m_clusterSize, m_colCnt);
+			}
+		}
+
+		m_borders.assign(m_clusters.size() * 2, {});
+		m_slot.assign(m_grid.cellCount(), GridModel::npos);
+		m_dirty.assign(m_clusters.size(), false);
+		m_localDistance.resize(static_cast<size_t>(m_clusterSize) * m_clusterSize);
+		m_localParent.resize(m_localDistance.size());
+		m_allDirty = true;
+	}
+
+	if(m_allDirty) {
+		m_dirtyList.clear();
+
+		for(uint32_t cluster = 0; cluster < m_clusters.size(); cluster++) {
+			m_dirty[cluster] = true;
+			m_dirtyList.push_back(cluster);
+		}
+
+		m_allDirty = false;
+	}
+
+	// an edited cluster changes the entrances on all four of its borders, so the node sets of its neighbours change too
+	const size_t editedCount = m_dirtyList.size();
+
+	for(size_t index = 0; index < editedCount; index++) {
+		const uint32_t cluster = m_dirtyList[index];
+		const uint32_t clusterRow = cluster / m_clusterCols;
+		const uint32_t clusterCol = cluster % m_clusterCols;
+
+		buildBorder(cluster, true);
+		buildBorder(cluster, false);
+
+		if(clusterCol) {
+			buildBorder(cluster - 1, true);
+		}
+
+		if(clusterRow) {
+			buildBorder(cluster - m_clusterCols, false);
+		}
+
+		for(size_t direction = 0; direction < GridModel::xCord.size(); direction++) {
+			const auto neighbourRow = static_cast<ptrdiff_t>(clusterRow) + GridModel::xCord[direction];
+			const auto neighbourCol = static_cast<ptrdiff_t>(clusterCol) + GridModel::yCord[direction];
+
+			if(neighbourRow < 0 || neighbourRow >= m_clusterRows || neighbourCol < 0 || neighbourCol >= m_clusterCols) {
+				continue;
+			}
+
+			const auto neighbour = static_cast<uint32_t>(neighbourRow * m_clusterCols + neighbourCol);
+
+			if(!m_dirty[neighbour]) {
+				m_dirty[neighbour] = true;
+				m_dirtyList.push_back(neighbour);
+			}
+		}
+	}
+
+	for(const auto cluster : m_dirtyList) {
+		buildCluster(cluster);
+		m_dirty[cluster] = false;
+	}
+
+	m_rebuilt += m_dirtyList.size();
+	m_dirtyList.clear();
+}
+
+void HpaSolver::buildBorder(const uint32_t cluster, const bool vertical) noexcept {
+	auto & border = m_borders[borderIndex(cluster, vertical)];
+	const Cluster & inside = m_clusters[cluster];
+	border.clear();
+
+	if(vertical ? inside.colEnd == m_colCnt : inside.rowEnd == m_rowCnt) {
+		return; // the grid edge
+	}
+
+	const uint32_t length = vertical ? inside.rowEnd - inside.rowBegin : inside.colEnd - inside.colBegin;
+	const auto pairAt = [&](const uint32_t offset) -> std::pair<uint32_t, uint32_t> {
+		if(vertical) {
+			return {m_grid.index(inside.rowBegin + offset, inside.colEnd - 1), m_grid.index(inside.rowBegin + offset, inside.colEnd)};
+		}
+
+		return {m_grid.index(inside.rowEnd - 1, inside.colBegin + offset), m_grid.index(inside.rowEnd, inside.colBegin + offset)};
+	};
+
+	uint32_t runBegin = 0;
+
+	for(uint32_t offset = 0; offset <= length; offset++) {
+		const bool open = offset < length && !m_grid.isBlock(pairAt(offset).first) && !m_grid.isBlock(pairAt(offset).second);
+
+		if(open) {
+			continue;
+		}
+
+		const uint32_t runLength = offset - runBegin;
+
+		if(runLength >= splitRun) {
+			border.push_back(pairAt(runBegin));
+			border.push_back(pairAt(offset - 1));
+		} else if(runLength) {
+			border.push_back(pairAt(runBegin + runLength / 2));
+		}
+
+		runBegin = offset + 1;
+	}
+}
+
+void HpaSolver::buildCluster(const uint32_t clusterIndex) noexcept {
+	Cluster & cluster = m_clusters[clusterIndex];
+
+	for(const auto & node : cluster.nodes) {
+		m_slot[node.cell] = GridModel::npos;
+	}
+
+	cluster.nodes.clear();
+
+	const auto addEntrance = [&](const uint32_t cell, const uint32_t across) {
+		if(m_slot[cell] == GridModel::npos) {
+			m_slot[cell] = static_cast<uint32_t>(cluster.nodes.size());
+			cluster.nodes.push_back({cell});
+		}
+
+		auto & slots = cluster.nodes[m_slot[cell]].across;
+		*std::find(slots.begin(), slots.end(), GridModel::npos) = across;
+	};
+
+	for(const bool vertical : {true, false}) {
+		for(const auto & [inside, outside] : m_borders[borderIndex(clusterIndex, vertical)]) {
+			addEntrance(inside, outside);
+		}
+	}
+
+	// the borders west and north are kept by the neighbours there, with this cluster on the outside
+	if(clusterIndex % m_clusterCols) {
+		for(const auto & [inside, outside] : m_borders[borderIndex(clusterIndex - 1, true)]) {
+			addEntrance(outside, inside);
+		}
+	}
+
+	if(clusterIndex >= m_clusterCols) {
+		for(const auto & [inside, outside] : m_borders[borderIndex(clusterIndex - m_clusterCols, false)]) {
+			addEntrance(outside, inside);
+		}
+	}
+
+	const size_t nodeCount = cluster.nodes.size();
+	cluster.distance.assign(nodeCount * nodeCount, UINT32_MAX);
+
+	for(size_t from = 0; from < nodeCount; from++) {
+		localSearch(cluster, cluster.nodes[from].cell, false);
+
+		for(size_t to = 0; to < nodeCount; to++) {
+			cluster.distance[from * nodeCount + to] = m_localDistance[localIndex(cluster, cluster.nodes[to].cell)];
+		}
+	}
+}
+
+void HpaSolver::localSearch(const Cluster & cluster, const uint32_t cell, const bool reverse) noexcept {
+	const uint32_t width = cluster.colEnd - cluster.colBegin;
+	const uint32_t height = cluster.rowEnd - cluster.rowBegin;
+	const size_t size = static_cast<size_t>(width) * height;
+
+	std::fill_n(m_localDistance.begin(), size, UINT32_MAX);
+	std::fill_n(m_localParent.begin(), size, GridModel::npos);
+	m_localQueue.reset(size);
+
+	const uint32_t start = localIndex(cluster, cell);
+	m_localDistance[start] = 0;
+	m_localQueue.push(0, start);
+
+	while(!m_localQueue.empty()) {
+		const auto [distance, local] = m_localQueue.pop();
+
+		if(distance != m_localDistance[local]) {
+			continue;
+		}
+
+		const uint32_t localRow = local / width;
+		const uint32_t localCol = local % width;
+		const uint32_t current = m_grid.index(cluster.rowBegin + localRow, cluster.colBegin + localCol);
+
+		// stepped in local coordinates, the cluster edge doubles as the bounds check
+		const auto visit = [&](const uint32_t togoLocal, const uint32_t togo) {
+			if(m_grid.isBlock(togo)) {
+				return;
+			}
+
+			// backwards the move togo -> current is relaxed, and it pays for entering current
+			const uint32_t next = distance + m_grid.cost(reverse ? current : togo);
+
+			if(next < m_localDistance[togoLocal]) {
+				m_localDistance[togoLocal] = next;
+				m_localParent[togoLocal] = local;
+				m_localQueue.push(next, togoLocal);
+			}
+		};
+
+		if(localRow) {
+			visit(local - width, current - m_colCnt);
+		}
+
+		if(localRow + 1 < height) {
+			visit(local + width, current + m_colCnt);
+		}
+
+		if(localCol + 1 < width) {
+			visit(local + 1, current + 1);
+		}
+
+		if(localCol) {
+			visit(local - 1, current - 1);
+		}
+	}
+}
+
+void HpaSolver::appendLocalPath(const Cluster & cluster, const uint32_t from, const uint32_t to, std::vector<uint32_t> & cells) noexcept {
+	localSearch(cluster, from, false);
+
+	const uint32_t width = cluster.colEnd - cluster.colBegin;
+	const size_t begin = cells.size();
+
+	for(uint32_t local = localIndex(cluster, to); local != localIndex(cluster, from); local = m_localParent[local]) {
+		cells.push_back(m_grid.index(cluster.rowBegin + local / width, cluster.colBegin + local % width));
+	}
+
+	std::reverse(cells.begin() + static_cast<ptrdiff_t>(begin), cells.end());
+}
+
+void HpaSolver::refinePath() noexcept {
+	std::vector<uint32_t> abstractPath;
+
+	for(uint32_t cell = m_target; cell != GridModel::npos; cell = m_pathParent.get(cell)) {
+		abstractPath.push_back(cell);
+	}
+
+	std::reverse(abstractPath.begin(), abstractPath.end());
+	m_path.assign(1, m_source);
+
+	// consecutive nodes either cross a border in one move or are joined by a route inside their shared cluster
+	for(size_t index = 1; index < abstractPath.size(); index++) {
+		const uint32_t from = abstractPath[index - 1];
+		const uint32_t to = abstractPath[index];
+
+		if(clusterOf(from) != clusterOf(to)) {
+			m_path.push_back(to);
+		} else {
+			appendLocalPath(m_clusters[clusterOf(from)], from, to, m_path);
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "core/mappedFile.h"
+
+bool MappedFile::open(const std::string & path) noexcept {
+	close();
+
+	const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+	if(descriptor < 0) {
+		return false;
+	}
+
+	struct stat status{};
+	void * mapping = MAP_FAILED;
+
+	if(!fstat(descriptor, &status) && status.st_size > 0) {
+		mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+	}
+
+	// the mapping keeps the file alive on its own
+	::close(descriptor);
+
+	if(mapping == MAP_FAILED) {
+		return false;
+	}
+
+	m_data = static_cast<const uint8_t *>(mapping);
+	m_size = static_cast<size_t>(status.st_size);
+	return true;
+}
+
+void MappedFile::close() noexcept {
+	if(m_data) {
+		munmap(const_cast<uint8_t *>(m_data), m_size);
+		m_data = nullptr;
+		m_size = 0;
+	}
+}
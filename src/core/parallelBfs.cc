@@ -0,0 +1,162 @@
+#include <algorithm>
+#include "core/parallelBfs.h"
+
+ParallelBfs::ParallelBfs(const GridModel & grid, const size_t threadCount)
+    : m_grid(grid), m_pool(threadCount), m_lanes(m_pool.size()), m_visited((grid.cellCount() + wordBits - 1) / wordBits),
+	m_parent(grid.cellCount()), m_distance(grid.cellCount()) {
+}
+
+uint32_t ParallelBfs::run(const uint32_t source, const uint32_t target) noexcept {
+	m_stats = {};
+	m_found.store(false, std::memory_order_relaxed);
+
+	// clearing is a pass over every word as well, so it is split like a level
+	const size_t words = m_visited.size();
+	const size_t share = (words + m_pool.size() - 1) / m_pool.size();
+
+	m_pool.run([this, words, share](const size_t index) {
+		const size_t end = std::min(words, (index + 1) * share);
+
+		for(size_t word = index * share; word < end; word++) {
+			m_visited[word].store(0, std::memory_order_relaxed);
+		}
+	});
+
+	for(auto & lane : m_lanes) {
+		lane.frontier.clear();
+		lane.cursor.store(0, std::memory_order_relaxed);
+	}
+
+	if(m_grid.isBlock(source)) {
+		return GridModel::npos;
+	}
+
+	claim(source);
+	m_parent[source] = GridModel::npos;
+	m_distance[source] = 0;
+	m_lanes.front().frontier.push_back(source);
+	m_stats.pushed = m_stats.peakFrontier = 1;
+
+	if(source == target) {
+		return 0;
+	}
+
+	for(uint32_t level = 1;; level++) {
+		size_t frontierSize = 0;
+
+		for(const auto & lane : m_lanes) {
+			frontierSize += lane.frontier.size();
+		}
+
+		if(!frontierSize) {
+			break;
+		}
+
+		m_stats.peakFrontier = std::max(m_stats.peakFrontier, frontierSize);
+
+		const auto expand = [this, level, target](const size_t index) {
+			expandLevel(index, level, target);
+		};
+
+		if(frontierSize < parallelThreshold) {
+			expand(0);
+		} else {
+			m_pool.run(expand);
+		}
+
+		for(auto & lane : m_lanes) {
+			std::swap(lane.frontier, lane.next);
+			lane.next.clear();
+			lane.cursor.store(0, std::memory_order_relaxed);
+			m_stats.pushed += lane.frontier.size();
+		}
+
+		if(m_found.load(std::memory_order_relaxed)) {
+			break;
+		}
+	}
+
+	for(auto & lane : m_lanes) {
+		m_stats.expanded += lane.expanded;
+		lane.expanded = 0;
+	}
+
+	if(target == GridModel::npos || !visited(target)) {
+		return GridModel::npos;
+	}
+
+	m_stats.pathLength = m_distance[target];
+	return m_distance[target];
+}
+
+std::vector<uint32_t> ParallelBfs::path(const uint32_t cell) const {
+	std::vector<uint32_t> cells;
+
+	if(!visited(cell)) {
+		return cells;
+	}
+
+	// a chain longer than the grid would be a cycle of parents, cut so a broken run shows as a path not from the source
+	for(uint32_t current = cell; current != GridModel::npos && cells.size() <= m_grid.cellCount(); current = m_parent[current]) {
+		cells.push_back(current);
+	}
+
+	std::reverse(cells.begin(), cells.end());
+	return cells;
+}
+
+void ParallelBfs::expandLevel(const size_t index, const uint32_t level, const uint32_t target) noexcept {
+	Lane & own = m_lanes[index];
+	const size_t laneCount = m_lanes.size();
+
+	for(size_t offset = 0; offset < laneCount; offset++) {
+		Lane & victim = m_lanes[(index + offset) % laneCount];
+		const size_t size = victim.frontier.size();
+
+		for(;;) {
+			// once target is claimed the rest of the level cannot change its distance
+			if(m_found.load(std::memory_order_relaxed)) {
+				return;
+			}
+
+			const size_t begin = victim.cursor.fetch_add(chunkSize, std::memory_order_relaxed);
+
+			if(begin >= size) {
+				break;
+			}
+
+			const size_t end = std::min(size, begin + chunkSize);
+			own.expanded += end - begin;
+
+			for(size_t position = begin; position < end; position++) {
+				const uint32_t cell = victim.frontier[position];
+
+				m_grid.forEachNeighbour(cell, [&](const uint32_t togo) {
+					if(m_grid.isBlock(togo) || !claim(togo)) {
+						return;
+					}
+
+					m_parent[togo] = cell;
+					m_distance[togo] = level;
+					own.next.push_back(togo);
+
+					if(togo == target) {
+						m_found.store(true, std::memory_order_relaxed);
+					}
+				});
+			}
+		}
+	}
+}
+
+bool ParallelBfs::claim(const uint32_t cell) noexcept {
+	std::atomic<uint64_t> & word = m_visited[cell / wordBits];
+	const uint64_t bit = uint64_t{1} << (cell % wordBits);
+
+	// the plain load skips the locked instruction for the many neighbours that are already visited
+	if(word.load(std::memory_order_relaxed) & bit) {
+		return false;
+	}
+
+	return !(word.fetch_or(bit, std::memory_order_relaxed) & bit);
+}
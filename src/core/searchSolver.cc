@@ -0,0 +1,609 @@
+#include <algorithm>
+#include <tuple>
+#include "core/searchSolver.h"
+#include "core/componentIndex.h"
+
+void SearchSolver::start(const uint32_t source, const uint32_t target) noexcept {
+	m_source = source;
+	m_target = target;
+	m_current = GridModel::npos;
+	m_currentDistance = 0;
+	m_stats = {};
+	m_pathParent.resize(m_grid.cellCount());
+	m_status = Status::Running;
+
+	if(m_trace) {
+		m_trace->begin(m_grid, source, target);
+	}
+
+	// a blocked source is still searched out of, as without the index
+	if(m_components && !m_grid.isBlock(source) && !m_components->connected(source, target)) {
+		m_status = m_grid.failed() ? Status::Failed : Status::Exhausted;
+
+		if(m_trace) {
+			m_trace->finish(false, {});
+		}
+
+		return;
+	}
+
+	reset();
+	m_stats.peakFrontier = frontierSize();
+}
+
+SearchSolver::Status SearchSolver::step() noexcept {
+	if(m_status != Status::Running) {
+		return m_status;
+	}
+
+	const bool expanded = expand();
+	m_stats.peakFrontier = std::max(m_stats.peakFrontier, frontierSize());
+
+	if(__builtin_expect(m_grid.failed(), 0)) {
+		// whatever the expansion read, cells around it or a graph reset() built, may be made up
+		m_status = Status::Failed;
+	} else if(!expanded) {
+		m_status = Status::Exhausted;
+	} else {
+		m_stats.expanded++;
+
+		if(m_trace) {
+			m_trace->recordPop(m_current, currentParent(), m_currentDistance);
+		}
+
+		if(reachedTarget()) {
+			m_status = Status::Found;
+		}
+	}
+
+	if(m_status != Status::Running) {
+		const auto cells = path();
+
+		if(!cells.empty()) {
+			m_stats.pathLength = static_cast<uint32_t>(cells.size() - 1);
+
+			for(size_t index = 1; index < cells.size(); index++) {
+				m_stats.pathCost += m_grid.cost(cells[index]);
+			}
+		}
+
+		if(m_trace) {
+			m_trace->finish(m_status == Status::Found, cells);
+		}
+	}
+
+	return m_status;
+}
+
+std::vector<uint32_t> SearchSolver::path() const noexcept {
+	std::vector<uint32_t> cells;
+
+	if(m_status != Status::Found) {
+		return cells;
+	}
+
+	cells.push_back(m_target);
+
+	// parents are adjacent except for jump point searches, whose skipped runs are filled in here
+	for(uint32_t cell = m_target; m_pathParent.get(cell) != GridModel::npos; cell = m_pathParent.get(cell)) {
+		GridModel::appendRun(cells, cell, m_pathParent.get(cell), m_grid.colCount());
+	}
+
+	std::reverse(cells.begin(), cells.end());
+	return cells;
+}
+
+void BfsSolver::reset() noexcept {
+	m_queue.clear();
+	m_queueHead = 0;
+	m_visited.resize(m_grid.cellCount());
+	m_queue.push_back({m_source, 0});
+	m_visited.insert(m_source);
+	recordPush(m_source);
+}
+
+bool BfsSolver::expand() noexcept {
+	if(m_queueHead == m_queue.size()) {
+		return false;
+	}
+
+	const auto [currentCell, currentDistance] = m_queue[m_queueHead++];
+	m_current = currentCell;
+	m_currentDistance = currentDistance;
+
+	if(currentCell == m_target) {
+		return true;
+	}
+
+	m_grid.forEachNeighbour(currentCell, [this, currentCell = currentCell, currentDistance = currentDistance](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell) || m_visited.contains(togoCell))
+			return;
+
+		m_visited.insert(togoCell);
+		m_pathParent.set(togoCell, currentCell);
+		m_queue.push_back({togoCell, currentDistance + 1});
+		recordPush(togoCell);
+	});
+
+	return true;
+}
+
+void DfsSolver::reset() noexcept {
+	m_stack.clear();
+	m_visited.resize(m_grid.cellCount());
+	m_stack.push_back({m_source, 0});
+	m_visited.insert(m_source);
+	recordPush(m_source);
+}
+
+bool DfsSolver::expand() noexcept {
+	if(m_stack.empty()) {
+		return false;
+	}
+
+	const auto [currentCell, currentDistance] = m_stack.back();
+	m_stack.pop_back();
+	m_current = currentCell;
+	m_currentDistance = currentDistance;
+
+	if(currentCell == m_target) {
+		return true;
+	}
+
+	m_grid.forEachNeighbour(currentCell, [this, currentCell = currentCell, currentDistance = currentDistance](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell) || m_visited.contains(togoCell))
+			return;
+
+		m_visited.insert(togoCell);
+		m_pathParent.set(togoCell, currentCell);
+		m_stack.push_back({togoCell, currentDistance + 1});
+		recordPush(togoCell);
+	});
+
+	return true;
+}
+
+template<typename Queue>
+void BasicDijkstraSolver<Queue>::reset() noexcept {
+	m_priorityQueue.reset(m_grid.cellCount());
+	m_distance.resize(m_grid.cellCount());
+	m_priorityQueue.push(0, m_source);
+	m_distance.set(m_source, 0);
+	recordPush(m_source);
+}
+
+template<typename Queue>
+bool BasicDijkstraSolver<Queue>::expand() noexcept {
+	uint32_t currentDistance = 0;
+	uint32_t currentCell = GridModel::npos;
+
+	// skip lazily deleted entries so every step is a real expansion
+	for(;;) {
+		if(m_priorityQueue.empty()) {
+			return false;
+		}
+
+		std::tie(currentDistance, currentCell) = m_priorityQueue.pop();
+
+		if(m_distance.get(currentCell) == currentDistance) {
+			break;
+		}
+
+		m_stats.stalePops++;
+	}
+
+	m_current = currentCell;
+	m_currentDistance = currentDistance;
+
+	if(currentCell == m_target) {
+		return true;
+	}
+
+	m_grid.forEachNeighbour(currentCell, [this, currentCell, currentDistance](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell))
+			return;
+
+		const auto newDistance = currentDistance + m_grid.cost(togoCell);
+
+		if(newDistance < m_distance.get(togoCell)) {
+			m_distance.set(togoCell, newDistance);
+			m_pathParent.set(togoCell, currentCell);
+			m_priorityQueue.push(newDistance, togoCell);
+			recordPush(togoCell);
+		}
+	});
+
+	return true;
+}
+
+template class BasicDijkstraSolver<BinaryHeapQueue>;
+template class BasicDijkstraSolver<DaryHeapQueue<4>>;
+template class BasicDijkstraSolver<DialQueue>;
+template class BasicDijkstraSolver<RadixHeapQueue>;
+
+std::unique_ptr<SearchSolver> makeDijkstraSolver(const GridModel & grid, const QueueBackend backend) {
+	switch(backend) {
+	case QueueBackend::BinaryHeap:
+		return std::make_unique<BasicDijkstraSolver<BinaryHeapQueue>>(grid);
+	case QueueBackend::DaryHeap:
+		return std::make_unique<BasicDijkstraSolver<DaryHeapQueue<4>>>(grid);
+	case QueueBackend::Dial:
+		return std::make_unique<BasicDijkstraSolver<DialQueue>>(grid);
+	case QueueBackend::Radix:
+		return std::make_unique<BasicDijkstraSolver<RadixHeapQueue>>(grid);
+	default:
+		__builtin_unreachable();
+	}
+}
+
+void BidirectionalBfsSolver::reset() noexcept {
+	const std::array<uint32_t, 2> roots{m_source, m_target};
+
+	for(size_t side = 0; side < m_frontiers.size(); side++) {
+		auto & frontier = m_frontiers[side];
+		frontier.queue.clear();
+		frontier.head = frontier.levelEnd = 0;
+		frontier.depth.resize(m_grid.cellCount());
+		frontier.queue.push_back(roots[side]);
+		frontier.depth.set(roots[side], 0);
+		recordPush(roots[side]);
+	}
+
+	m_backwardParent.resize(m_grid.cellCount());
+	m_levelOpen = false;
+	m_bestLength = GridModel::npos;
+	m_meetForward = m_meetBackward = GridModel::npos;
+	m_met = false;
+}
+
+bool BidirectionalBfsSolver::expand() noexcept {
+	// the trees only meet across a move, a lone cell is found on its first pop like the one way searches do
+	if(m_source == m_target) {
+		m_side = 0;
+		m_current = m_meetForward = m_source;
+		m_currentDistance = m_bestLength = 0;
+		m_met = true;
+		return true;
+	}
+
+	if(!m_levelOpen) {
+		const size_t forwardSize = m_frontiers[0].queue.size() - m_frontiers[0].head;
+		const size_t backwardSize = m_frontiers[1].queue.size() - m_frontiers[1].head;
+
+		// a tree that ran out without touching the other one is a whole component
+		if(!forwardSize || !backwardSize) {
+			return false;
+		}
+
+		m_side = forwardSize <= backwardSize ? 0 : 1;
+		m_frontiers[m_side].levelEnd = m_frontiers[m_side].queue.size();
+		m_levelOpen = true;
+	}
+
+	auto & frontier = m_frontiers[m_side];
+	const auto & other = m_frontiers[1 - m_side];
+	auto & parents = m_side ? m_backwardParent : m_pathParent;
+
+	const uint32_t currentCell = frontier.queue[frontier.head++];
+	m_current = currentCell;
+	m_currentDistance = frontier.depth.get(currentCell);
+
+	m_grid.forEachNeighbour(currentCell, [&, currentCell](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell))
+			return;
+
+		if(const uint32_t otherDepth = other.depth.get(togoCell); otherDepth != GridModel::npos) {
+			const uint32_t length = m_currentDistance + 1 + otherDepth;
+
+			if(length < m_bestLength) {
+				m_bestLength = length;
+				m_meetForward = m_side ? togoCell : currentCell;
+				m_meetBackward = m_side ? currentCell : togoCell;
+			}
+		}
+
+		if(frontier.depth.get(togoCell) != GridModel::npos)
+			return;
+
+		frontier.depth.set(togoCell, m_currentDistance + 1);
+		parents.set(togoCell, currentCell);
+		frontier.queue.push_back(togoCell);
+		recordPush(togoCell);
+	});
+
+	if(frontier.head == frontier.levelEnd) {
+		m_levelOpen = false;
+		m_met = m_bestLength != GridModel::npos;
+	}
+
+	if(m_met) {
+		m_currentDistance = m_bestLength;
+	}
+
+	return true;
+}
+
+std::vector<uint32_t> BidirectionalBfsSolver::path() const noexcept {
+	std::vector<uint32_t> cells;
+
+	if(m_status != Status::Found) {
+		return cells;
+	}
+
+	for(uint32_t cell = m_meetForward; cell != GridModel::npos; cell = m_pathParent.get(cell)) {
+		cells.push_back(cell);
+	}
+
+	std::reverse(cells.begin(), cells.end());
+
+	for(uint32_t cell = m_meetBackward; cell != GridModel::npos; cell = m_backwardParent.get(cell)) {
+		cells.push_back(cell);
+	}
+
+	return cells;
+}
+
+void BidirectionalDijkstraSolver::reset() noexcept {
+	const std::array<uint32_t, 2> roots{m_source, m_target};
+
+	for(size_t side = 0; side < m_frontiers.size(); side++) {
+		auto & frontier = m_frontiers[side];
+		frontier.heap.clear();
+		frontier.distance.resize(m_grid.cellCount());
+		frontier.heap.push_back({0, roots[side]});
+		frontier.distance.set(roots[side], 0);
+		recordPush(roots[side]);
+	}
+
+	m_backwardParent.resize(m_grid.cellCount());
+	m_bestLength = UINT32_MAX;
+	m_meetForward = m_meetBackward = GridModel::npos;
+	m_met = false;
+}
+
+uint32_t BidirectionalDijkstraSolver::liveTop(Frontier & frontier) noexcept {
+	while(!frontier.heap.empty() && frontier.distance.get(frontier.heap.front().second) != frontier.heap.front().first) {
+		std::pop_heap(frontier.heap.begin(), frontier.heap.end(), std::greater<>());
+		frontier.heap.pop_back();
+		m_stats.stalePops++;
+	}
+
+	return frontier.heap.empty() ? UINT32_MAX : frontier.heap.front().first;
+}
+
+bool BidirectionalDijkstraSolver::expand() noexcept {
+	// as in BidirectionalBfsSolver::expand
+	if(m_source == m_target) {
+		m_side = 0;
+		m_current = m_meetForward = m_source;
+		m_currentDistance = m_bestLength = 0;
+		m_met = true;
+		return true;
+	}
+
+	if(liveTop(m_frontiers[0]) == UINT32_MAX || liveTop(m_frontiers[1]) == UINT32_MAX) {
+		return false;
+	}
+
+	m_side = m_frontiers[0].heap.size() <= m_frontiers[1].heap.size() ? 0 : 1;
+	auto & frontier = m_frontiers[m_side];
+	const auto & other = m_frontiers[1 - m_side];
+	auto & parents = m_side ? m_backwardParent : m_pathParent;
+
+	std::pop_heap(frontier.heap.begin(), frontier.heap.end(), std::greater<>());
+	const auto [currentDistance, currentCell] = frontier.heap.back();
+	frontier.heap.pop_back();
+	m_current = currentCell;
+	m_currentDistance = currentDistance;
+
+	m_grid.forEachNeighbour(currentCell, [&, currentCell = currentCell, currentDistance = currentDistance](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell))
+			return;
+
+		// a move onto a cell pays its cost, seen from the target that is the cell being left
+		const auto newDistance = currentDistance + m_grid.cost(m_side ? currentCell : togoCell);
+
+		if(const uint32_t otherDistance = other.distance.get(togoCell); otherDistance != UINT32_MAX && newDistance + otherDistance < m_bestLength) {
+			m_bestLength = newDistance + otherDistance;
+			m_meetForward = m_side ? togoCell : currentCell;
+			m_meetBackward = m_side ? currentCell : togoCell;
+		}
+
+		if(newDistance < frontier.distance.get(togoCell)) {
+			frontier.distance.set(togoCell, newDistance);
+			parents.set(togoCell, currentCell);
+			frontier.heap.push_back({newDistance, togoCell});
+			std::push_heap(frontier.heap.begin(), frontier.heap.end(), std::greater<>());
+			recordPush(togoCell);
+		}
+	});
+
+	// nothing left in either heap can close a shorter route than the best crossing
+	if(m_bestLength != UINT32_MAX) {
+		const uint64_t forwardTop = liveTop(m_frontiers[0]);
+		const uint64_t backwardTop = liveTop(m_frontiers[1]);
+		m_met = forwardTop + backwardTop >= m_bestLength;
+	}
+
+	if(m_met) {
+		m_currentDistance = m_bestLength;
+	}
+
+	return true;
+}
+
+std::vector<uint32_t> BidirectionalDijkstraSolver::path() const noexcept {
+	std::vector<uint32_t> cells;
+
+	if(m_status != Status::Found) {
+		return cells;
+	}
+
+	for(uint32_t cell = m_meetForward; cell != GridModel::npos; cell = m_pathParent.get(cell)) {
+		cells.push_back(cell);
+	}
+
+	std::reverse(cells.begin(), cells.end());
+
+	for(uint32_t cell = m_meetBackward; cell != GridModel::npos; cell = m_backwardParent.get(cell)) {
+		cells.push_back(cell);
+	}
+
+	return cells;
+}
+
+void AStarSolver::reset() noexcept {
+	m_activeHeuristic = m_heuristic;
+	m_openList.clear();
+	m_distance.resize(m_grid.cellCount());
+
+	const uint32_t estimate = estimateDistance(m_activeHeuristic, m_grid, m_source, m_target);
+	m_openList.push_back({estimate, estimate, m_source});
+	m_distance.set(m_source, 0);
+	recordPush(m_source);
+}
+
+bool AStarSolver::popOpen() noexcept {
+	// an entry is stale once its cell was reached by a shorter route, skip those like Dijkstra does
+	while(!m_openList.empty() && m_distance.get(m_openList.front().cell) != m_openList.front().priority - m_openList.front().estimate) {
+		std::pop_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+		m_openList.pop_back();
+		m_stats.stalePops++;
+	}
+
+	if(m_openList.empty()) {
+		return false;
+	}
+
+	std::pop_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+	const auto [priority, estimate, currentCell] = m_openList.back();
+	m_openList.pop_back();
+	m_current = currentCell;
+	m_currentDistance = priority - estimate;
+	return true;
+}
+
+void AStarSolver::relax(const uint32_t cell, const uint32_t distance, const uint32_t parent) noexcept {
+	if(distance >= m_distance.get(cell)) {
+		return;
+	}
+
+	const uint32_t estimate = estimateDistance(m_activeHeuristic, m_grid, cell, m_target);
+	m_distance.set(cell, distance);
+	m_pathParent.set(cell, parent);
+	m_openList.push_back({distance + estimate, estimate, cell});
+	std::push_heap(m_openList.begin(), m_openList.end(), std::greater<>());
+	recordPush(cell);
+}
+
+bool AStarSolver::expand() noexcept {
+	if(!popOpen()) {
+		return false;
+	}
+
+	if(m_current == m_target) {
+		return true;
+	}
+
+	m_grid.forEachNeighbour(m_current, [this, currentCell = m_current, currentDistance = m_currentDistance](const uint32_t togoCell) {
+		if(m_grid.isBlock(togoCell))
+			return;
+
+		relax(togoCell, currentDistance + m_grid.cost(togoCell), currentCell);
+	});
+
+	return true;
+}
+
+bool JpsSolver::expand() noexcept {
+	if(!popOpen()) {
+		return false;
+	}
+
+	if(m_current == m_target) {
+		return true;
+	}
+
+	const uint32_t parent = m_pathParent.get(m_current);
+
+	if(parent == GridModel::npos) {
+		for(size_t direction = 0; direction < GridModel::xCord.size(); direction++) {
+			jumpFrom(m_current, GridModel::xCord[direction], GridModel::yCord[direction]);
+		}
+
+		return true;
+	}
+
+	// only the natural neighbour ahead and the two sides can start a shorter path than one through the parent
+	const auto [row, col] = m_grid.getCord(m_current);
+	const auto [parentRow, parentCol] = m_grid.getCord(parent);
+
+	if(row == parentRow) {
+		const int32_t colStep = col > parentCol ? 1 : -1;
+		jumpFrom(m_current, -1, 0);
+		jumpFrom(m_current, 1, 0);
+		jumpFrom(m_current, 0, colStep);
+	} else {
+		const int32_t rowStep = row > parentRow ? 1 : -1;
+		jumpFrom(m_current, 0, -1);
+		jumpFrom(m_current, 0, 1);
+		jumpFrom(m_current, rowStep, 0);
+	}
+
+	return true;
+}
+
+void JpsSolver::jumpFrom(const uint32_t cell, const int32_t rowStep, const int32_t colStep) noexcept {
+	const auto [row, col] = m_grid.getCord(cell);
+	const uint32_t jumpPoint = jump(static_cast<ptrdiff_t>(row) + rowStep, static_cast<ptrdiff_t>(col) + colStep, rowStep, colStep);
+
+	if(jumpPoint == GridModel::npos) {
+		return;
+	}
+
+	// jumps are straight, so the Manhattan distance is the exact cost of the skipped run
+	relax(jumpPoint, m_currentDistance + estimateDistance(Heuristic::Manhattan, m_grid, cell, jumpPoint), cell);
+}
+
+uint32_t JpsSolver::jumpHorizontal(const ptrdiff_t row, ptrdiff_t col, const int32_t colStep) const noexcept {
+	for(; walkable(row, col); col += colStep) {
+		const uint32_t cell = m_grid.index(static_cast<uint32_t>(row), static_cast<uint32_t>(col));
+
+		if(cell == m_target) {
+			return cell;
+		}
+
+		// a side opening right after a wall can only be reached optimally through this cell
+		if((walkable(row - 1, col) && !walkable(row - 1, col - colStep)) || (walkable(row + 1, col) && !walkable(row + 1, col - colStep))) {
+			return cell;
+		}
+	}
+
+	return GridModel::npos;
+}
+
+uint32_t JpsSolver::jump(ptrdiff_t row, const ptrdiff_t col, const int32_t rowStep, const int32_t colStep) const noexcept {
+	if(rowStep == 0) {
+		return jumpHorizontal(row, col, colStep);
+	}
+
+	// iterative rather than recursive, a vertical run over a large open map would otherwise overflow the stack
+	for(; walkable(row, col); row += rowStep) {
+		const uint32_t cell = m_grid.index(static_cast<uint32_t>(row), static_cast<uint32_t>(col));
+
+		if(cell == m_target) {
+			return cell;
+		}
+
+		if((walkable(row, col - 1) && !walkable(row - rowStep, col - 1)) || (walkable(row, col + 1) && !walkable(row - rowStep, col + 1))) {
+			return cell;
+		}
+
+		// moving vertically, any horizontal jump point makes this cell one too
+		if(jumpHorizontal(row, col + 1, 1) != GridModel::npos || jumpHorizontal(row, col - 1, -1) != GridModel::npos) {
+			return cell;
+		}
+	}
+
+	return GridModel::npos;
+}
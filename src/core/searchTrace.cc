@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include "core/searchTrace.h"
+
+void SearchTrace::begin(const GridModel & grid, const uint32_t source, const uint32_t target) noexcept {
+	// another search of the same grid keeps the blocks and only undoes the index entries of the cells the last one popped,
+	// so a short search after a long one stays short
+	if(m_gridVersion == grid.version() && m_blocked.size() == grid.cellCount() && m_steps.size() < m_blocked.size()) {
+		for(const auto & [cell, parent, distance, pushEnd] : m_steps) {
+			m_firstPop[cell] = m_lastPop[cell] = GridModel::npos;
+
+			if(parent != GridModel::npos) {
+				m_retireStep[parent] = GridModel::npos;
+			}
+		}
+
+		m_found = m_complete = false;
+		m_steps.clear();
+		m_pushes.clear();
+		m_path.clear();
+		m_previousPop.clear();
+		m_source = source;
+		m_target = target;
+		return;
+	}
+
+	clear();
+	m_rowCnt = grid.rowCount();
+	m_colCnt = grid.colCount();
+	m_source = source;
+	m_target = target;
+	m_gridVersion = grid.version();
+	m_blocked.resize(grid.cellCount());
+
+	for(uint32_t cell = 0; cell < grid.cellCount(); cell++) {
+		m_blocked[cell] = grid.isBlock(cell);
+	}
+
+	m_firstPop.assign(m_blocked.size(), GridModel::npos);
+	m_lastPop.assign(m_blocked.size(), GridModel::npos);
+	m_retireStep.assign(m_blocked.size(), GridModel::npos);
+}
+
+void SearchTrace::finish(const bool found, const std::vector<uint32_t> & path) noexcept {
+	// taken from the solver rather than rebuilt from the steps, bidirectional searches stitch two trees
+	m_found = found;
+	m_complete = true;
+	m_path = path;
+}
+
+void SearchTrace::clear() noexcept {
+	// keeps capacity, a replayed grid usually records a trace of about the same size again
+	m_rowCnt = m_colCnt = 0;
+	m_source = m_target = GridModel::npos;
+	m_gridVersion = 0;
+	m_found = false;
+	m_complete = false;
+	m_blocked.clear();
+	m_steps.clear();
+	m_pushes.clear();
+	m_path.clear();
+	m_firstPop.clear();
+	m_lastPop.clear();
+	m_previousPop.clear();
+	m_retireStep.clear();
+}
+
+void SearchTrace::buildIndex() noexcept {
+	m_firstPop.assign(m_blocked.size(), GridModel::npos);
+	m_lastPop.assign(m_blocked.size(), GridModel::npos);
+	m_previousPop.resize(m_steps.size());
+	m_retireStep.assign(m_blocked.size(), GridModel::npos);
+
+	for(uint32_t step = 0; step < stepCount(); step++) {
+		const auto & [cell, parent, distance, pushEnd] = m_steps[step];
+		m_previousPop[step] = m_lastPop[cell];
+		m_lastPop[cell] = step;
+
+		if(m_firstPop[cell] == GridModel::npos) {
+			m_firstPop[cell] = step;
+		}
+
+		if(parent != GridModel::npos && m_retireStep[parent] == GridModel::npos) {
+			m_retireStep[parent] = step;
+		}
+	}
+}
+
+template<typename T>
+static void writeValue(std::ostream & stream, const T & value) {
+	stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template<typename T>
+static void writeVector(std::ostream & stream, const std::vector<T> & values) {
+	stream.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template<typename T>
+static bool readValue(std::istream & stream, T & value) {
+	return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+// grows with what the stream holds, so a corrupt count fails at the end of the data instead of allocating it up front
+template<typename T>
+static bool readVector(std::istream & stream, std::vector<T> & values, const uint64_t count) {
+	constexpr uint64_t chunk = (1 << 20) / sizeof(T);
+	values.clear();
+
+	for(uint64_t done = 0; done < count;) {
+		const auto length = static_cast<size_t>(std::min(chunk, count - done));
+		values.resize(static_cast<size_t>(done) + length);
+
+		if(!stream.read(reinterpret_cast<char *>(values.data() + done), static_cast<std::streamsize>(length * sizeof(T)))) {
+			return false;
+		}
+
+		done += length;
+	}
+
+	return true;
+}
+
+bool SearchTrace::write(std::ostream & stream) const noexcept {
+	writeValue(stream, magic);
+	writeValue(stream, version);
+	writeValue(stream, m_rowCnt);
+	writeValue(stream, m_colCnt);
+	writeValue(stream, m_source);
+	writeValue(stream, m_target);
+	writeValue(stream, static_cast<uint8_t>(m_found));
+	writeValue(stream, stepCount());
+	writeValue(stream, static_cast<uint64_t>(m_pushes.size()));
+	writeValue(stream, static_cast<uint32_t>(m_path.size()));
+	writeVector(stream, m_blocked);
+	writeVector(stream, m_steps);
+	writeVector(stream, m_pushes);
+	writeVector(stream, m_path);
+	return static_cast<bool>(stream);
+}
+
+bool SearchTrace::read(std::istream & stream) noexcept {
+	clear();
+
+	uint32_t fileMagic = 0;
+	uint32_t fileVersion = 0;
+	uint8_t found = 0;
+	uint32_t stepCnt = 0;
+	uint64_t pushCnt = 0;
+	uint32_t pathLength = 0;
+
+	const bool headerRead = readValue(stream, fileMagic) && readValue(stream, fileVersion) && readValue(stream, m_rowCnt) &&
+					readValue(stream, m_colCnt) && readValue(stream, m_source) && readValue(stream, m_target) &&
+					readValue(stream, found) && readValue(stream, stepCnt) && readValue(stream, pushCnt) &&
+					readValue(stream, pathLength);
+
+	if(!headerRead || fileMagic != magic || fileVersion != version || !GridModel::validDimensions(m_rowCnt, m_colCnt)) {
+		clear();
+		return false;
+	}
+
+	const uint32_t cellCnt = m_rowCnt * m_colCnt;
+
+	// solvers pop and push a cell as often as they like, only the push offsets of the steps bound the push count. a path
+	// visits a cell once
+	if(m_source >= cellCnt || m_target >= cellCnt || pushCnt > UINT32_MAX || pathLength > cellCnt) {
+		clear();
+		return false;
+	}
+
+	m_found = found;
+
+	if(!readVector(stream, m_blocked, cellCnt) || !readVector(stream, m_steps, stepCnt) || !readVector(stream, m_pushes, pushCnt) ||
+	   !readVector(stream, m_path, pathLength)) {
+		clear();
+		return false;
+	}
+
+	uint32_t previousPushEnd = 0;
+
+	for(const auto & [cell, parent, distance, pushEnd] : m_steps) {
+		if(cell >= cellCnt || (parent != GridModel::npos && parent >= cellCnt) || pushEnd < previousPushEnd || pushEnd > pushCnt) {
+			clear();
+			return false;
+		}
+
+		previousPushEnd = pushEnd;
+	}
+
+	for(const auto cell : m_path) {
+		if(cell >= cellCnt) {
+			clear();
+			return false;
+		}
+	}
+
+	buildIndex();
+	m_complete = true;
+	return true;
+}
@@ -0,0 +1,102 @@
+#include <chrono>
+#include <algorithm>
+#include "core/searchWorker.h"
+
+void SearchWorker::RingRecorder::flush() noexcept {
+	size_t published = 0;
+
+	while(published < m_batchSize) {
+		published += m_worker.m_ring.push(m_batch.data() + published, m_batchSize - published);
+
+		if(published == m_batchSize) {
+			break;
+		}
+
+		// the consumer is paused or behind, wait for room without burning a core
+		if(m_worker.m_cancel.load(std::memory_order_relaxed)) {
+			break;
+		}
+
+		const auto sleepStart = std::chrono::steady_clock::now();
+		std::this_thread::sleep_for(std::chrono::microseconds(250));
+		m_blocked += std::chrono::steady_clock::now() - sleepStart;
+	}
+
+	m_batchSize = 0;
+}
+
+void SearchWorker::start(SearchSolver & solver, const uint32_t source, const uint32_t target) noexcept {
+	cancel();
+	m_path.clear();
+	m_active = true;
+	m_thread = std::thread(&SearchWorker::work, this, std::ref(solver), source, target);
+}
+
+void SearchWorker::cancel() noexcept {
+	m_cancel.store(true, std::memory_order_relaxed);
+	join();
+	m_ring.reset();
+	m_cancel.store(false, std::memory_order_relaxed);
+	m_active = false;
+}
+
+void SearchWorker::join() noexcept {
+	if(m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+
+void SearchWorker::work(SearchSolver & solver, const uint32_t source, const uint32_t target) noexcept {
+	RingRecorder recorder(*this);
+	const auto searchStart = std::chrono::steady_clock::now();
+	solver.setTrace(&recorder);
+	solver.start(source, target);
+
+	// finish() flushes the last batch together with the outcome
+	while(!m_cancel.load(std::memory_order_relaxed) && solver.step() == SearchSolver::Status::Running)
+		;
+
+	solver.setTrace(nullptr);
+	m_stats = solver.stats();
+	m_stats.solverSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - searchStart - recorder.blocked()).count();
+}
+
+size_t SearchWorker::drain(TraceRecorder & recorder, const size_t maxEvents) noexcept {
+	size_t drained = 0;
+
+	while(m_active && drained < maxEvents) {
+		const size_t popped = m_ring.pop(m_drained.data(), std::min(m_drained.size(), maxEvents - drained));
+
+		if(!popped) {
+			break;
+		}
+
+		for(size_t index = 0; index < popped; index++) {
+			const auto & [kind, cell, parent, distance] = m_drained[index];
+
+			switch(kind) {
+			case Kind::Push:
+				recorder.recordPush(cell);
+				break;
+			case Kind::Pop:
+				recorder.recordPop(cell, parent, distance);
+				break;
+			case Kind::PathCell:
+				m_path.push_back(cell);
+				break;
+			case Kind::Found:
+			case Kind::Exhausted:
+				join(); // the outcome is the last event, the worker is already leaving and m_stats is final
+				m_active = false;
+				recorder.finish(kind == Kind::Found, m_path);
+				break;
+			default:
+				__builtin_unreachable();
+			}
+		}
+
+		drained += popped;
+	}
+
+	return drained;
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include "core/threadPool.h"
+
+ThreadPool::ThreadPool(const size_t threadCount) {
+	const size_t total = threadCount ? threadCount : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+	for(size_t index = 1; index < total; index++) {
+		m_threads.emplace_back(&ThreadPool::work, this, index);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		const std::lock_guard lock(m_mutex);
+		m_stop = true;
+	}
+
+	m_wake.notify_all();
+
+	for(auto & thread : m_threads) {
+		thread.join();
+	}
+}
+
+void ThreadPool::run(const std::function<void(size_t index)> & task) noexcept {
+	if(m_threads.empty()) {
+		task(0);
+		return;
+	}
+
+	{
+		const std::lock_guard lock(m_mutex);
+		m_task = &task;
+		m_pending = m_threads.size();
+		m_round++;
+	}
+
+	m_wake.notify_all();
+	task(0);
+
+	std::unique_lock lock(m_mutex);
+	m_done.wait(lock, [this] { return !m_pending; });
+	m_task = nullptr;
+}
+
+void ThreadPool::work(const size_t index) noexcept {
+	uint64_t served = 0;
+
+	for(;;) {
+		const std::function<void(size_t)> * task = nullptr;
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_wake.wait(lock, [this, served] { return m_stop || m_round != served; });
+
+			if(m_stop) {
+				return;
+			}
+
+			served = m_round;
+			task = m_task;
+		}
+
+		(*task)(index);
+
+		{
+			const std::lock_guard lock(m_mutex);
+
+			if(--m_pending) {
+				continue;
+			}
+		}
+
+		m_done.notify_one();
+	}
+}
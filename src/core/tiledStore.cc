@@ -0,0 +1,158 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include "core/tiledStore.h"
+#include "core/gridModel.h"
+
+struct TiledFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t rowCnt;
+	uint32_t colCnt;
+	uint32_t tileSize;
+	uint32_t reserved;
+};
+
+constexpr static uint32_t tiledMagic = 0x4c545650; // "PVTL"
+constexpr static uint32_t tiledVersion = 1;
+constexpr static size_t headerBytes = 4096; // keeps the records after it page aligned
+
+static uint32_t tileCount(const uint32_t cellCnt) noexcept {
+	return (cellCnt + TiledStore::tileSize - 1) / TiledStore::tileSize;
+}
+
+std::shared_ptr<TiledStore> TiledStore::open(const std::string & path, const size_t residentLimit) noexcept {
+	const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+	if(descriptor < 0) {
+		return nullptr;
+	}
+
+	TiledFileHeader header{};
+	struct stat status{};
+	const bool headerRead =
+	    pread(descriptor, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && !fstat(descriptor, &status);
+	const bool valid = headerRead && header.magic == tiledMagic && header.version == tiledVersion && header.tileSize == tileSize &&
+				 GridModel::validDimensions(header.rowCnt, header.colCnt);
+
+	if(!valid || static_cast<uint64_t>(status.st_size) !=
+			     headerBytes + static_cast<uint64_t>(tileCount(header.rowCnt)) * tileCount(header.colCnt) * recordBytes) {
+		::close(descriptor);
+		return nullptr;
+	}
+
+	auto file = std::make_shared<const File>(descriptor);
+	return std::shared_ptr<TiledStore>(new TiledStore(std::move(file), header.rowCnt, header.colCnt, std::max<size_t>(residentLimit, 1)));
+}
+
+bool TiledStore::write(const GridModel & grid, const std::string & path) noexcept {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	std::vector<uint8_t> page(std::max(headerBytes, recordBytes));
+	const TiledFileHeader header{tiledMagic, tiledVersion, grid.rowCount(), grid.colCount(), tileSize, 0};
+	std::memcpy(page.data(), &header, sizeof(header));
+	file.write(reinterpret_cast<const char *>(page.data()), static_cast<std::streamsize>(headerBytes));
+
+	// cells past the grid edge pad the tiles of the last row and column, they are never read
+	for(uint32_t tileRow = 0; tileRow < tileCount(grid.rowCount()); tileRow++) {
+		for(uint32_t tileCol = 0; tileCol < tileCount(grid.colCount()); tileCol++) {
+			std::fill(page.begin(), page.end(), 0);
+
+			for(uint32_t local = 0; local < tileSize * tileSize; local++) {
+				const uint32_t row = tileRow * tileSize + local / tileSize;
+				const uint32_t col = tileCol * tileSize + local % tileSize;
+
+				if(row < grid.rowCount() && col < grid.colCount()) {
+					const uint32_t cell = grid.index(row, col);
+					page[local / 8] |= static_cast<uint8_t>(grid.isBlock(cell) << local % 8);
+					page[blockBytes + local] = grid.cost(cell);
+				}
+			}
+
+			file.write(reinterpret_cast<const char *>(page.data()), static_cast<std::streamsize>(recordBytes));
+		}
+	}
+
+	// a tiled grid that failed to map a tile wrote made up cells
+	return file && !grid.failed();
+}
+
+bool TiledStore::isTiledFile(const uint8_t * const data, const size_t size) noexcept {
+	uint32_t magic = 0;
+
+	if(size >= sizeof(TiledFileHeader)) {
+		std::memcpy(&magic, data, sizeof(magic));
+	}
+
+	return magic == tiledMagic;
+}
+
+TiledStore::File::File(const int descriptor) noexcept : descriptor(descriptor) {
+}
+
+TiledStore::File::~File() {
+	::close(descriptor);
+}
+
+TiledStore::TiledStore(std::shared_ptr<const File> file, const uint32_t rowCnt, const uint32_t colCnt, const size_t residentLimit)
+    : m_file(std::move(file)), m_rowCnt(rowCnt), m_colCnt(colCnt), m_tileCols(tileCount(colCnt)), m_residentLimit(residentLimit),
+	m_records(static_cast<size_t>(tileCount(rowCnt)) * m_tileCols, nullptr), m_residents(m_records.size()) {
+}
+
+TiledStore::~TiledStore() {
+	for(const auto & resident : m_lru) {
+		munmap(resident.mapping, resident.length);
+	}
+}
+
+std::shared_ptr<TiledStore> TiledStore::copy() const {
+	auto store = std::shared_ptr<TiledStore>(new TiledStore(m_file, m_rowCnt, m_colCnt, m_residentLimit));
+	store->m_failed = m_failed;
+	return store;
+}
+
+const uint8_t * TiledStore::load(const uint32_t tile) const noexcept {
+	// records sit on 4 KiB boundaries, larger pages map a little of the record before along
+	const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+	const uint64_t offset = headerBytes + static_cast<uint64_t>(tile) * recordBytes;
+	const uint64_t mapOffset = offset / pageSize * pageSize;
+	const auto length = static_cast<size_t>(offset - mapOffset + recordBytes);
+	void * const mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, m_file->descriptor, static_cast<off_t>(mapOffset));
+
+	if(mapping == MAP_FAILED) {
+		m_failed = true;
+		return nullptr;
+	}
+
+	// the whole record is about to be read, one request instead of a fault per page
+	madvise(mapping, length, MADV_WILLNEED);
+
+	m_lru.push_front({tile, mapping, length});
+	m_residents[tile] = m_lru.begin();
+	m_records[tile] = static_cast<const uint8_t *>(mapping) + (offset - mapOffset);
+	m_tileLoads++;
+
+	if(m_lru.size() > m_residentLimit) {
+		const auto & victim = m_lru.back();
+		munmap(victim.mapping, victim.length);
+		m_records[victim.tile] = nullptr;
+		m_lru.pop_back();
+	}
+
+	return m_records[tile];
+}
+
+const uint8_t * TiledStore::unreadable() noexcept {
+	// blocks keep a search from spreading into cells nobody read, its result is thrown away over failed() anyway
+	static const auto record = [] {
+		std::array<uint8_t, recordBytes> blocks{};
+		std::fill(blocks.begin(), blocks.begin() + blockBytes, UINT8_MAX);
+		return blocks;
+	}();
+
+	return record.data();
+}
@@ -0,0 +1,384 @@
+#include <QGraphicsSceneMouseEvent>
+#include <QStyleOptionGraphicsItem>
+#include <QPainter>
+#include <QImage>
+#include <QCursor>
+#include <QTimer>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "gridItem.h"
+#include "spriteAtlas.h"
+
+static_assert(GridItem::stateCount == static_cast<size_t>(GridItem::State::JumpPoint) + 1);
+static_assert(GridItem::stateCount <= 8, "states are packed into the low three bits of a cell");
+
+GridItem::GridItem(GridModel & grid, AnimationClock & clock, const int32_t spacing, QGraphicsItem * parent)
+    : QGraphicsObject(parent), m_grid(grid), m_clock(clock), m_pitch(dimension + spacing), m_tileCols((grid.colCount() + tileSize - 1) / tileSize),
+	m_cells(grid.cellCount(), static_cast<uint8_t>(State::Inactive)) {
+	const uint32_t tileRows = (grid.rowCount() + tileSize - 1) / tileSize;
+	m_dirtyTiles.assign(static_cast<size_t>(tileRows) * m_tileCols, 0);
+
+	setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+	setAcceptedMouseButtons(Qt::LeftButton);
+
+	connect(&m_clock, &AnimationClock::tick, this, &GridItem::advanceTweens);
+}
+
+void GridItem::setState(const uint32_t cell, const State newState, const bool runAnimations, const uint32_t pathParent) noexcept {
+	assert(newState == State::Active || newState == State::Inactive || newState == State::Visited || newState == State::Inpath ||
+		 newState == State::JumpPoint);
+
+	uint8_t rotation = 0;
+
+	if(newState == State::Active && pathParent != GridModel::npos) {
+		rotation = rotationIndex(m_grid.getCord(cell), m_grid.getCord(pathParent));
+	}
+
+	m_cells[cell] = static_cast<uint8_t>((m_cells[cell] & tweenFlag) | static_cast<uint8_t>(newState) | rotation << rotationShift);
+
+	if(runAnimations) {
+		startTween(cell);
+	}
+
+	markDirty(cell);
+}
+
+void GridItem::setBlock(const uint32_t cell, const bool block, const bool runAnimations) noexcept {
+	// walls and cleared walls are plain ground, an open cell staying open (a moved source or target) keeps its terrain
+	if(block || m_grid.isBlock(cell)) {
+		m_grid.setCost(cell, GridModel::minimumCost);
+	}
+
+	m_grid.setBlock(cell, block);
+	setState(cell, State::Inactive, runAnimations);
+	emit cellEdited(cell);
+}
+
+void GridItem::setCost(const uint32_t cell, const uint8_t cost, const bool runAnimations) noexcept {
+	m_grid.setBlock(cell, false);
+	m_grid.setCost(cell, cost);
+	setState(cell, State::Inactive, runAnimations);
+	emit cellEdited(cell);
+}
+
+void GridItem::setSource(const uint32_t cell) noexcept {
+	if(m_source != GridModel::npos) {
+		markDirty(m_source);
+	}
+
+	m_source = cell;
+	setBlock(cell, false);
+}
+
+void GridItem::setTarget(const uint32_t cell) noexcept {
+	if(m_target != GridModel::npos) {
+		markDirty(m_target);
+	}
+
+	m_target = cell;
+	setBlock(cell, false);
+}
+
+void GridItem::clearStates(const bool clearBlocks) noexcept {
+	if(clearBlocks) {
+		m_grid.clearBlocks();
+		m_grid.clearCosts();
+		emit cellEdited(GridModel::npos);
+	}
+
+	m_tweens.clear();
+	std::fill(m_cells.begin(), m_cells.end(), static_cast<uint8_t>(State::Inactive));
+	update();
+}
+
+void GridItem::markDirty(const uint32_t cell) noexcept {
+	const auto [row, col] = m_grid.getCord(cell);
+	const uint32_t tile = (row / tileSize) * m_tileCols + col / tileSize;
+
+	if(!m_dirtyTiles[tile]) {
+		m_dirtyTiles[tile] = true;
+		m_dirtyList.push_back(tile);
+	}
+
+	if(!m_flushPending) {
+		// coalesce every change made during this event loop iteration into one repaint per tile
+		m_flushPending = true;
+		QTimer::singleShot(0, this, &GridItem::flushDirty);
+	}
+}
+
+void GridItem::flushDirty() noexcept {
+	const qreal tileExtent = tileSize * m_pitch;
+
+	for(const auto tile : m_dirtyList) {
+		const auto tileRow = tile / m_tileCols;
+		const auto tileCol = tile % m_tileCols;
+		update(QRectF(tileCol * tileExtent, tileRow * tileExtent, tileExtent, tileExtent).intersected(boundingRect()));
+		m_dirtyTiles[tile] = false;
+	}
+
+	m_dirtyList.clear();
+	m_flushPending = false;
+}
+
+void GridItem::startTween(const uint32_t cell) noexcept {
+	if(m_cells[cell] & tweenFlag) {
+		return; // already animating, like a running timeline the new icon simply shows up mid tween
+	}
+
+	// near full speed, or with too many cells in flight, tweens would only cost frames without being seen
+	if(!m_tweensEnabled || m_tweens.size() >= maximumTweens) {
+		return;
+	}
+
+	m_cells[cell] |= tweenFlag;
+	m_tweens.push_back({cell, m_clock.now()});
+	m_clock.requestFrame();
+}
+
+void GridItem::advanceTweens(const qint64 now) noexcept {
+	if(m_tweens.empty()) {
+		return;
+	}
+
+	const qint64 totalDuration = 2 * static_cast<qint64>(m_timerDuration);
+
+	for(const auto & tween : m_tweens) {
+		markDirty(tween.cell);
+	}
+
+	const auto finished = std::remove_if(m_tweens.begin(), m_tweens.end(), [this, now, totalDuration](const Tween & tween) {
+		if(now - tween.startTime < totalDuration) {
+			return false;
+		}
+
+		m_cells[tween.cell] &= static_cast<uint8_t>(~tweenFlag);
+		return true;
+	});
+
+	m_tweens.erase(finished, m_tweens.end());
+
+	if(!m_tweens.empty()) {
+		m_clock.requestFrame();
+	}
+}
+
+qreal GridItem::tweenScale(const qint64 elapsed) const noexcept {
+	// shrink to 70% then grow back, both halves eased with InQuad like the old per node timelines
+	const qreal duration = m_timerDuration;
+
+	if(elapsed < m_timerDuration) {
+		const qreal progress = (duration - static_cast<qreal>(elapsed)) / duration;
+		return 0.7 + 0.3 * progress * progress;
+	}
+
+	const qreal progress = std::min<qreal>(1, static_cast<qreal>(elapsed - m_timerDuration) / duration);
+	return 0.7 + 0.3 * progress * progress;
+}
+
+GridItem::CellRange GridItem::visibleRange(const QRectF & exposedRect) const noexcept {
+	const QRectF area = exposedRect.intersected(boundingRect());
+	const auto clampTo = [](const qreal value, const uint32_t limit) {
+		return static_cast<uint32_t>(std::clamp<qreal>(value, 0, limit));
+	};
+
+	return {clampTo(std::floor(area.top() / m_pitch), m_grid.rowCount()), clampTo(std::floor(area.bottom() / m_pitch) + 1, m_grid.rowCount()),
+		  clampTo(std::floor(area.left() / m_pitch), m_grid.colCount()), clampTo(std::floor(area.right() / m_pitch) + 1, m_grid.colCount())};
+}
+
+void GridItem::paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget *) noexcept {
+	const auto range = visibleRange(option->exposedRect);
+	const qreal levelOfDetail = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+
+	if(levelOfDetail * dimension < minimumIconSize) {
+		paintCoarse(painter, range);
+		return;
+	}
+
+	m_fragments.clear();
+
+	for(uint32_t row = range.rowBegin; row < range.rowEnd; row++) {
+		for(uint32_t col = range.colBegin; col < range.colEnd; col++) {
+			const uint32_t cell = m_grid.index(row, col);
+
+			if(!(m_cells[cell] & tweenFlag)) {
+				appendFragment(cell, 1);
+			}
+		}
+	}
+
+	const qint64 now = m_clock.now();
+
+	for(const auto & tween : m_tweens) {
+		const auto [row, col] = m_grid.getCord(tween.cell);
+
+		if(row >= range.rowBegin && row < range.rowEnd && col >= range.colBegin && col < range.colEnd) {
+			appendFragment(tween.cell, tweenScale(now - tween.startTime));
+		}
+	}
+
+	// every visible cell in a single call against the shared sheet
+	painter->setRenderHint(QPainter::SmoothPixmapTransform);
+	painter->drawPixmapFragments(m_fragments.data(), static_cast<int32_t>(m_fragments.size()), SpriteAtlas::instance().sheet());
+	paintCostShades(painter, range);
+}
+
+// none on plain ground, then from faint up to a tint that still lets the icon below show through
+static int32_t costAlpha(const uint8_t cost) noexcept {
+	constexpr int32_t faintest = 40;
+	constexpr int32_t strongest = 200;
+
+	if(cost == GridModel::minimumCost) {
+		return 0;
+	}
+
+	return faintest + (cost - GridModel::minimumCost - 1) * (strongest - faintest) / (GridModel::maximumCost - GridModel::minimumCost - 1);
+}
+
+void GridItem::paintCostShades(QPainter * painter, const CellRange & range) const noexcept {
+	QColor shade(costShade);
+
+	for(uint32_t row = range.rowBegin; row < range.rowEnd; row++) {
+		for(uint32_t col = range.colBegin; col < range.colEnd; col++) {
+			const uint32_t cell = m_grid.index(row, col);
+			const uint8_t cost = m_grid.cost(cell);
+
+			// blocks reset their cost, so only the special cells need skipping
+			if(cost == GridModel::minimumCost || isSpecial(cell)) {
+				continue;
+			}
+
+			shade.setAlpha(costAlpha(cost));
+			painter->fillRect(cellRect(cell), shade);
+		}
+	}
+}
+
+void GridItem::appendFragment(const uint32_t cell, const qreal scale) noexcept {
+	const State state = getState(cell);
+	const uint8_t rotation = state == State::Active ? m_cells[cell] >> rotationShift & 0x03 : 0;
+	const QRectF source = SpriteAtlas::instance().sourceRect(state, rotation);
+
+	m_fragments.push_back(QPainter::PixmapFragment::create(cellRect(cell).center(), source, scale, scale, 0, scale));
+}
+
+void GridItem::paintCoarse(QPainter * painter, const CellRange & range) const noexcept {
+	// one pixel per cell, stretched over the visible cells in a single draw call
+	const auto width = static_cast<int32_t>(range.colEnd - range.colBegin);
+	const auto height = static_cast<int32_t>(range.rowEnd - range.rowBegin);
+
+	if(width <= 0 || height <= 0) {
+		return;
+	}
+
+	const auto & atlas = SpriteAtlas::instance();
+	QImage image(width, height, QImage::Format_RGB32);
+
+	for(int32_t y = 0; y < height; y++) {
+		auto * line = reinterpret_cast<QRgb *>(image.scanLine(y));
+
+		for(int32_t x = 0; x < width; x++) {
+			const uint32_t cell = m_grid.index(range.rowBegin + static_cast<uint32_t>(y), range.colBegin + static_cast<uint32_t>(x));
+			const QRgb color = atlas.flatColor(getState(cell));
+			const int32_t alpha = isSpecial(cell) ? 0 : costAlpha(m_grid.cost(cell));
+			const auto blend = [alpha](const int32_t base, const int32_t shade) {
+				return base + (shade - base) * alpha / 255;
+			};
+
+			line[x] = qRgb(blend(qRed(color), qRed(costShade)), blend(qGreen(color), qGreen(costShade)), blend(qBlue(color), qBlue(costShade)));
+		}
+	}
+
+	const QRectF target(range.colBegin * m_pitch, range.rowBegin * m_pitch, width * m_pitch, height * m_pitch);
+	painter->drawImage(target, image);
+}
+
+uint32_t GridItem::cellAt(const QPointF position) const noexcept {
+	const auto row = static_cast<ptrdiff_t>(std::floor(position.y() / m_pitch));
+	const auto col = static_cast<ptrdiff_t>(std::floor(position.x() / m_pitch));
+
+	if(!m_grid.validCordinate(row, col)) {
+		return GridModel::npos;
+	}
+
+	return m_grid.index(static_cast<uint32_t>(row), static_cast<uint32_t>(col));
+}
+
+void GridItem::invertCell(const uint32_t cell) noexcept {
+	if(isSpecial(cell)) {
+		return;
+	}
+
+	setBlock(cell, !m_grid.isBlock(cell));
+}
+
+void GridItem::paintCell(const uint32_t cell) noexcept {
+	if(isSpecial(cell) || (!m_grid.isBlock(cell) && m_grid.cost(cell) == m_dragCost)) {
+		return;
+	}
+
+	setCost(cell, m_dragCost);
+}
+
+void GridItem::mousePressEvent(QGraphicsSceneMouseEvent * event) noexcept {
+	const uint32_t cell = cellAt(event->pos());
+
+	if(cell == GridModel::npos || (m_algorithmRunning && cell == m_source)) {
+		event->ignore();
+		return;
+	}
+
+	if(cell == m_source) {
+		m_dragMode = DragMode::Source;
+		setCursor(Qt::ClosedHandCursor);
+	} else if(cell == m_target) {
+		m_dragMode = DragMode::Target;
+		setCursor(Qt::ClosedHandCursor);
+	} else if(m_brush == wallBrush) {
+		m_dragMode = DragMode::Inverter;
+		invertCell(cell);
+	} else {
+		// like the inverter, starting on a cell that already has the brush cost erases instead
+		const bool erase = !m_grid.isBlock(cell) && m_grid.cost(cell) == m_brush;
+		m_dragMode = DragMode::Painter;
+		m_dragCost = erase ? GridModel::minimumCost : m_brush;
+		paintCell(cell);
+	}
+
+	m_lastDragCell = cell;
+	event->accept();
+}
+
+void GridItem::mouseMoveEvent(QGraphicsSceneMouseEvent * event) noexcept {
+	const uint32_t cell = cellAt(event->pos());
+
+	if(cell == GridModel::npos || cell == m_lastDragCell) {
+		return;
+	}
+
+	m_lastDragCell = cell;
+
+	if(m_dragMode == DragMode::Inverter) {
+		invertCell(cell);
+	} else if(m_dragMode == DragMode::Painter) {
+		paintCell(cell);
+	}
+}
+
+void GridItem::mouseReleaseEvent(QGraphicsSceneMouseEvent * event) noexcept {
+	const uint32_t cell = cellAt(event->pos());
+
+	if(cell != GridModel::npos && !isSpecial(cell)) {
+		if(m_dragMode == DragMode::Source) {
+			setSource(cell);
+		} else if(m_dragMode == DragMode::Target) {
+			setTarget(cell);
+		}
+	}
+
+	m_dragMode = DragMode::None;
+	m_lastDragCell = GridModel::npos;
+	unsetCursor();
+	QGraphicsObject::mouseReleaseEvent(event);
+}
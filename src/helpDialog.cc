@@ -34,7 +34,8 @@ QWidget * StackedWidget::populateDefinitionPage() noexcept {
 	bottomLabel->setText(R"(<strong>Information</strong> : Displays information about the current 
          algorithm<br><strong>Run/Stop/Continue</strong> - Starts, Continues or stops current algorithm<br><strong>
          Reset</strong> - Resets the grid to the initial state (also remvoes all placed blocks) <br><strong>
-         Random</strong> - Generates a random grid.<br><strong>Help</strong> - Opens this help menu.<br><strong>
+         Random</strong> - Generates a random grid.<br><strong>Save/Load</strong> - Writes the grid to a .pvgrid file or reads
+         one back, MovingAI .map files load as well.<br><strong>Help</strong> - Opens this help menu.<br><strong>
          Exit</strong> - Exits the visualizer.)");
 
 	bottomLabel->setAlignment(Qt::AlignLeft);
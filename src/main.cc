@@ -1,10 +1,12 @@
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QGraphicsView>
 #include <QScreen>
 #include <QIcon>
 #include <QFile>
 #include <QRect>
 #include "scene.h"
+#include "core/gridFile.h"
 
 int main(int argc, char ** argv) {
 	QApplication app(argc, argv);
@@ -15,9 +17,50 @@ int main(int argc, char ** argv) {
 		app.setStyleSheet(file.readAll());
 	}
 
+	QCommandLineParser parser;
+	parser.setApplicationDescription("Path Visualizer");
+	parser.addHelpOption();
+
+	const QCommandLineOption rowsOption("rows", "Number of grid rows.", "count", QString::number(GraphicsScene::defaultRowCnt));
+	const QCommandLineOption colsOption("cols", "Number of grid columns.", "count", QString::number(GraphicsScene::defaultColCnt));
+	const QCommandLineOption mapOption("map", "Grid to open, a .pvgrid or MovingAI .map file. Overrides --rows and --cols.", "file");
+	parser.addOption(rowsOption);
+	parser.addOption(colsOption);
+	parser.addOption(mapOption);
+	parser.process(app);
+
+	bool validRows = false;
+	bool validCols = false;
+	uint32_t rowCnt = parser.value(rowsOption).toUInt(&validRows);
+	uint32_t colCnt = parser.value(colsOption).toUInt(&validCols);
+	std::unique_ptr<GridModel> grid;
+
+	if(parser.isSet(mapOption)) {
+		grid = loadGrid(parser.value(mapOption).toStdString());
+
+		if(!grid) {
+			qCritical("Cannot read the grid file, see --help");
+			return 1;
+		}
+
+		rowCnt = grid->rowCount();
+		colCnt = grid->colCount();
+		validRows = validCols = true;
+	}
+
+	if(!validRows || !validCols || !GridModel::validDimensions(rowCnt, colCnt)) {
+		qCritical("Invalid grid dimensions, see --help");
+		return 1;
+	}
+
 	auto windowSize = QApplication::primaryScreen()->availableSize();
 
-	GraphicsScene scene(windowSize);
+	GraphicsScene scene(windowSize, rowCnt, colCnt);
+
+	if(grid) {
+		scene.setGrid(*grid);
+	}
+
 	QGraphicsView view(&scene);
 
 	view.setWindowIcon(QIcon(":/pixmaps/icons/windowIcon.png"));
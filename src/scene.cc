@@ -1,5 +1,14 @@
 #include <QTabWidget>
 #include <QSlider>
+#include <QComboBox>
+#include <QCheckBox>
+#include <QSpinBox>
+#include <QFile>
+#include <QFileDialog>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QSignalBlocker>
 #include <QSignalTransition>
 #include <QGraphicsLineItem>
 #include <QGraphicsLayoutItem>
@@ -13,23 +22,23 @@
 #include <QHBoxLayout>
 #include <QGraphicsView>
 #include <QGridLayout>
-#include <QGraphicsGridLayout>
 #include <QGraphicsLinearLayout>
 #include <QGraphicsWidget>
 #include <memory>
+#include <algorithm>
 #include <QGraphicsProxyWidget>
 #include <QWidget>
 #include <QStateMachine>
 #include <QState>
-#include <stack>
-#include <queue>
 #include <QTimer>
-#include <QGraphicsOpacityEffect>
 #include <QTabBar>
 #include <QIcon>
 #include "scene.h"
+#include "gridView.h"
+#include "spriteAtlas.h"
 #include "pushButton.h"
 #include "defines.h"
+#include "core/gridFile.h"
 
 void GraphicsScene::populateBar() noexcept {
 	m_bar = std::make_unique<QTabWidget>();
@@ -41,6 +50,7 @@ void GraphicsScene::populateBar() noexcept {
 		const QString algorithmName = "BFS";
 		m_bar->addTab(bfsWidget, algorithmName);
 		populateWidget(bfsWidget, algorithmName, ::bfsInfo);
+		populateBidirectionalBox(bfsWidget);
 	}
 	{
 		auto * dfsWidget = new QWidget(m_bar.get());
@@ -53,34 +63,101 @@ void GraphicsScene::populateBar() noexcept {
 		const QString algorithmName = "Dijkstra";
 		m_bar->addTab(dijkstraWidget, algorithmName);
 		populateWidget(dijkstraWidget, algorithmName, ::dijkstraInfo);
+		populateBidirectionalBox(dijkstraWidget);
+		populateQueueBox(dijkstraWidget);
+		populateFieldBox(dijkstraWidget);
 	}
+	{
+		auto * aStarWidget = new QWidget(m_bar.get());
+		const QString algorithmName = "A*";
+		m_bar->addTab(aStarWidget, algorithmName);
+		populateWidget(aStarWidget, algorithmName, ::aStarInfo);
+		populateHeuristicBox(aStarWidget);
+	}
+	{
+		auto * jpsWidget = new QWidget(m_bar.get());
+		const QString algorithmName = "JPS";
+		m_bar->addTab(jpsWidget, algorithmName);
+		populateWidget(jpsWidget, algorithmName, ::jpsInfo);
+	}
+	{
+		auto * hpaWidget = new QWidget(m_bar.get());
+		const QString algorithmName = "HPA*";
+		m_bar->addTab(hpaWidget, algorithmName);
+		populateWidget(hpaWidget, algorithmName, ::hpaInfo);
+	}
+	{
+		auto * dStarLiteWidget = new QWidget(m_bar.get());
+		const QString algorithmName = "D* Lite";
+		m_bar->addTab(dStarLiteWidget, algorithmName);
+		populateWidget(dStarLiteWidget, algorithmName, ::dStarLiteInfo);
+	}
+
+	connect(m_bar.get(), &QTabWidget::currentChanged, this, &GraphicsScene::syncTimeline);
 }
 
 void GraphicsScene::allocDataStructures() noexcept {
-	m_queue = std::make_unique<std::queue<std::pair<Node *, uint32_t>>>(); // {:m_distance}
-	m_stack = std::make_unique<std::stack<std::pair<Node *, uint32_t>>>(); // {:m_distance}
-	m_visited = std::make_unique<std::vector<std::vector<bool>>>();
-	m_distance = std::make_unique<std::vector<std::vector<uint32_t>>>();
-	m_priorityQueue = std::make_unique<std::priority_queue<pIntNode, std::vector<pIntNode>, std::greater<>>>(); // {m_distance:}
+	m_grid = std::make_unique<GridModel>(m_rowCnt, m_colCnt);
+	m_snapshot = std::make_unique<GridModel>(m_rowCnt, m_colCnt);
+	m_components = std::make_unique<ComponentIndex>(*m_snapshot);
+
+	for(auto tabIndex : {TabIndex::Bfs, TabIndex::Dfs, TabIndex::Dijkstra, TabIndex::AStar, TabIndex::Jps, TabIndex::Hpa,
+			     TabIndex::DStarLite}) {
+		m_solvers.push_back(makeSolver(tabIndex, false));
+		m_bidirectionalSolvers.push_back(makeSolver(tabIndex, true));
+	}
+
+	m_fieldSolver = std::make_unique<DistanceFieldSolver>(*m_snapshot);
+	m_oneWayExpansions.assign(m_solvers.size(), {});
+	m_editedCells.clear(); // the new incremental solvers start from scratch on their first run
+	m_snapshotEdits.assign(1, GridModel::npos);
+	m_snapshotVersion = 0;
+}
+
+void GraphicsScene::memsetDs() noexcept {
+	// solver buffers are generation stamped, SearchSolver::start clears them in O(1)
+	m_solver = nullptr;
 }
 
-void GraphicsScene::memsetDs() const noexcept {
-	while(!m_queue->empty())
-		m_queue->pop();
-	while(!m_stack->empty())
-		m_stack->pop();
-	while(!m_priorityQueue->empty())
-		m_priorityQueue->pop();
+std::unique_ptr<SearchSolver> GraphicsScene::makeSolver(const TabIndex tabIndex, const bool bidirectional) const noexcept {
+	if(bidirectional) {
+		switch(tabIndex) {
+		case TabIndex::Bfs:
+			return std::make_unique<BidirectionalBfsSolver>(*m_snapshot);
+		case TabIndex::Dijkstra:
+			return std::make_unique<BidirectionalDijkstraSolver>(*m_snapshot);
+		default:
+			return nullptr;
+		}
+	}
 
-	m_distance->assign(rowCnt, std::vector<uint32_t>(colCnt, std::numeric_limits<uint32_t>::max()));
-	m_visited->assign(rowCnt, std::vector<bool>(colCnt, false));
+	switch(tabIndex) {
+	case TabIndex::Bfs:
+		return std::make_unique<BfsSolver>(*m_snapshot);
+	case TabIndex::Dfs:
+		return std::make_unique<DfsSolver>(*m_snapshot);
+	case TabIndex::Dijkstra:
+		return makeDijkstraSolver(*m_snapshot, m_solverQueueBackend);
+	case TabIndex::AStar:
+		return std::make_unique<AStarSolver>(*m_snapshot);
+	case TabIndex::Jps:
+		return std::make_unique<JpsSolver>(*m_snapshot);
+	case TabIndex::Hpa:
+		return std::make_unique<HpaSolver>(*m_snapshot);
+	case TabIndex::DStarLite:
+		return std::make_unique<DStarLiteSolver>(*m_snapshot);
+	default:
+		__builtin_unreachable();
+	}
 }
 
 void GraphicsScene::populateWidget(QWidget * holder, const QString & algorithmName, const QString & infoText) noexcept {
 	auto * mainLayout = new QGridLayout(holder);
 	mainLayout->setSpacing(10);
 
-	auto * view = new QGraphicsView(innerScene, holder);
+	m_bidirectionalBoxes.push_back(nullptr); // see populateBidirectionalBox
+
+	auto * view = new GridView(innerScene, holder);
 	view->setMaximumHeight(windowSize.height() + yOffset);
 	mainLayout->setAlignment(Qt::AlignTop);
 	mainLayout->addWidget(view, 0, 0);
@@ -93,6 +170,7 @@ void GraphicsScene::populateWidget(QWidget * holder, const QString & algorithmNa
 	populateSideLayout(holder, sideLayout, algorithmName, infoText);
 
 	populateLegend(holder, sideLayout);
+	populateStatsPanel(holder, sideLayout);
 	populateBottomLayout(holder, mainLayout);
 }
 
@@ -102,6 +180,8 @@ void GraphicsScene::populateSideLayout(QWidget * holder, QVBoxLayout * sideLayou
 	auto * statusButton = new PushButton("Run", holder);
 	auto * resetButton = new PushButton("Reset", holder);
 	auto * randomButton = new PushButton("Random", holder);
+	auto * saveButton = new PushButton("Save", holder);
+	auto * loadButton = new PushButton("Load", holder);
 	auto * helpButton = new PushButton("Help", holder);
 	auto * exitButton = new PushButton("Exit", holder);
 
@@ -109,9 +189,11 @@ void GraphicsScene::populateSideLayout(QWidget * holder, QVBoxLayout * sideLayou
 	sideLayout->addWidget(statusButton);
 	sideLayout->addWidget(resetButton);
 	sideLayout->addWidget(randomButton);
+	sideLayout->addWidget(saveButton);
+	sideLayout->addWidget(loadButton);
 	sideLayout->addWidget(helpButton);
 	sideLayout->addWidget(exitButton);
-	sideLayout->insertSpacing(4, 25);
+	sideLayout->insertSpacing(6, 25);
 
 	configureMachine(holder, statusButton);
 
@@ -129,24 +211,14 @@ void GraphicsScene::populateSideLayout(QWidget * holder, QVBoxLayout * sideLayou
 			statusButton->setText("Stop");
 
 			if(toStartNew) {
+				m_repairLive = false;
 				cleanup();
 				memsetDs();
 			}
-			switch(m_bar->currentIndex()) {
-			case static_cast<uint32_t>(TabIndex::Bfs):
-				bfsStart(toStartNew);
-				break;
-			case static_cast<uint32_t>(TabIndex::Dfs):
-				dfsStart(toStartNew);
-				break;
-			case static_cast<uint32_t>(TabIndex::Dijkstra):
-				dijkstraStart(toStartNew);
-				break;
-			default:
-				__builtin_unreachable();
-			}
+
+			searchStart(toStartNew);
 		} else {
-			stopTimers();
+			stopStepping();
 			statusButton->setText("Continue");
 		}
 	});
@@ -161,6 +233,13 @@ void GraphicsScene::populateSideLayout(QWidget * holder, QVBoxLayout * sideLayou
 		generateRandGridPattern();
 	});
 
+	connect(saveButton, &PushButton::released, this, &GraphicsScene::saveMap);
+
+	connect(loadButton, &PushButton::released, statusButton, [this, statusButton] {
+		statusButton->setText("Run");
+		loadMap();
+	});
+
 	connect(helpButton, &PushButton::released, helpDialogWidget.get(), &QStackedWidget::show);
 
 	connect(exitButton, &QPushButton::released, this, [this] {
@@ -172,50 +251,74 @@ void GraphicsScene::populateSideLayout(QWidget * holder, QVBoxLayout * sideLayou
 	});
 }
 
-void GraphicsScene::resetGrid() const noexcept {
-	stopTimers();
+void GraphicsScene::resetGrid() noexcept {
+	stopStepping();
 	emit resetButtons();
 	memsetDs();
-
-	for(size_t row = 0; row < rowCnt; row++) {
-		for(size_t col = 0; col < colCnt; col++) {
-			auto * node = getNodeAt(row, col);
-			if(isSpecial(node))
-				continue;
-			node->setPathParent(nullptr);
-			constexpr bool runAnimations = false;
-			node->setType(Node::State::Inactive, runAnimations);
-		}
-	}
+	m_worker.cancel();
+	m_trace.clear();
+	m_replayPosition = 0;
+	m_pathMarked = false;
+	m_repairLive = false;
+	std::fill(m_oneWayExpansions.begin(), m_oneWayExpansions.end(), ExpansionCount{});
+	syncTimeline();
+	updateExpansions();
+
+	constexpr bool clearBlocks = true;
+	m_gridItem->clearStates(clearBlocks);
 
 	const auto curTabIndex = static_cast<uint32_t>(m_bar->currentIndex());
 	auto * lineInfo = getStatusBar(curTabIndex);
 	lineInfo->setText("Click on run Button on sidem_bar to display algorithm status");
 }
 
-void GraphicsScene::generateRandGridPattern() noexcept {
-	m_sourceNodeCord = getRandomCord();
-	while((m_targetNodeCord = getRandomCord()) == m_sourceNodeCord)
-		;
+void GraphicsScene::setGrid(const GridModel & grid) noexcept {
+	assert(grid.rowCount() == m_rowCnt && grid.colCount() == m_colCnt);
+	resetGrid();
+	*m_grid = grid;
+	noteEdit(GridModel::npos);
+
+	const auto openCell = [this](const uint32_t avoid) {
+		for(uint32_t attempt = 0; attempt < 4 * m_grid->cellCount(); attempt++) {
+			if(const uint32_t cell = getRandomCell(); cell != avoid && !m_grid->isBlock(cell)) {
+				return cell;
+			}
+		}
+
+		return avoid ? 0u : 1u; // hardly anything open, the endpoint clears its cell below
+	};
+
+	if(m_grid->isBlock(m_gridItem->source())) {
+		m_gridItem->setSource(openCell(m_gridItem->target()));
+	}
+
+	if(m_grid->isBlock(m_gridItem->target())) {
+		m_gridItem->setTarget(openCell(m_gridItem->source()));
+	}
+
+	for(const auto cell : {m_gridItem->source(), m_gridItem->target()}) {
+		m_grid->setBlock(cell, false);
+	}
 
-	m_sourceNode->setType(Node::State::Inactive);
-	m_targetNode->setType(Node::State::Inactive);
+	m_gridItem->update();
+}
 
-	const auto [sourceX, sourceY] = m_sourceNodeCord;
-	const auto [targetX, targetY] = m_targetNodeCord;
+void GraphicsScene::generateRandGridPattern() noexcept {
+	const uint32_t sourceCell = getRandomCell();
+	uint32_t targetCell;
 
-	m_sourceNode = getNodeAt(sourceX, sourceY);
-	m_targetNode = getNodeAt(targetX, targetY);
+	while((targetCell = getRandomCell()) == sourceCell)
+		;
 
-	updateSourceTargetNodes();
+	m_gridItem->setSource(sourceCell);
+	m_gridItem->setTarget(targetCell);
 
-	for(uint32_t placed = 0; placed < maximumBlocks;) {
-		auto [randX, randY] = getRandomCord();
-		auto node = getNodeAt(randX, randY);
+	// one draw per cell, so the share of blocks is blockDensity on any size without retrying cells that are taken already
+	std::bernoulli_distribution blockDist(blockDensity);
 
-		if(!isSpecial(node) && binaryDist(generator)) {
-			node->setType(Node::State::Block);
-			placed++;
+	for(uint32_t cell = 0; cell < m_grid->cellCount(); cell++) {
+		if(blockDist(generator) && !m_gridItem->isSpecial(cell)) {
+			m_gridItem->setBlock(cell, true);
 		}
 	}
 }
@@ -260,31 +363,40 @@ void GraphicsScene::populateLegend(QWidget * holder, QVBoxLayout * sideLayout) c
 	legendLabel->setObjectName("legendTitle"); // for css
 	addShadowEffect(legendLabel);
 
-	sideLayout->addLayout(getLegendLayout(holder, "source"));
-	sideLayout->addLayout(getLegendLayout(holder, "target"));
-	sideLayout->addLayout(getLegendLayout(holder, "active"));
-	sideLayout->addLayout(getLegendLayout(holder, "inactive"));
-	sideLayout->addLayout(getLegendLayout(holder, "visited"));
-	sideLayout->addLayout(getLegendLayout(holder, "block"));
-	sideLayout->addLayout(getLegendLayout(holder, "inpath"));
+	sideLayout->addLayout(getLegendLayout(holder, "source", GridItem::State::Source));
+	sideLayout->addLayout(getLegendLayout(holder, "target", GridItem::State::Target));
+	sideLayout->addLayout(getLegendLayout(holder, "active", GridItem::State::Active));
+	sideLayout->addLayout(getLegendLayout(holder, "inactive", GridItem::State::Inactive));
+	sideLayout->addLayout(getLegendLayout(holder, "visited", GridItem::State::Visited));
+	sideLayout->addLayout(getLegendLayout(holder, "block", GridItem::State::Block));
+	sideLayout->addLayout(getLegendLayout(holder, "inpath", GridItem::State::Inpath));
+	sideLayout->addLayout(getLegendLayout(holder, "jump point", GridItem::State::JumpPoint));
 }
 
-void GraphicsScene::populateBottomLayout(QWidget * holder, QGridLayout * mainLayout) const noexcept {
-	auto * infoLine = new QLineEdit("Click on run Button on sidem_bar to display algorithm status", holder);
-	infoLine->setAlignment(Qt::AlignCenter);
-	infoLine->setReadOnly(true);
+void GraphicsScene::populateStatsPanel(QWidget * holder, QVBoxLayout * sideLayout) noexcept {
+	sideLayout->addSpacing(25);
 
-	connect(this, &GraphicsScene::foundPath, [infoLine] {
-		auto currentText = infoLine->text();
-		QString digits;
+	auto * statsTitle = new QLabel("Statistics:", holder);
+	statsTitle->setObjectName("legendTitle"); // for css
+	addShadowEffect(statsTitle);
 
-		for(auto character : currentText) {
-			if(character.isNumber())
-				digits += character;
-		}
+	auto * statsLabel = new QLabel("No finished run yet", holder);
+	m_statsLabels.push_back(statsLabel);
 
-		infoLine->setText(QString("Final Distance : %1").arg(digits));
-	});
+	auto * exportButton = new PushButton("Export", holder);
+	exportButton->setToolTip("Save the statistics of every finished run as JSON");
+
+	sideLayout->addWidget(statsTitle);
+	sideLayout->addWidget(statsLabel);
+	sideLayout->addWidget(exportButton);
+
+	connect(exportButton, &QPushButton::released, this, &GraphicsScene::exportRuns);
+}
+
+void GraphicsScene::populateBottomLayout(QWidget * holder, QGridLayout * mainLayout) noexcept {
+	auto * infoLine = new QLineEdit("Click on run Button on sidem_bar to display algorithm status", holder);
+	infoLine->setAlignment(Qt::AlignCenter);
+	infoLine->setReadOnly(true);
 
 	{
 		auto * shadowEffect = new QGraphicsDropShadowEffect(infoLine);
@@ -296,7 +408,7 @@ void GraphicsScene::populateBottomLayout(QWidget * holder, QGridLayout * mainLay
 	auto * slider = new QSlider(Qt::Horizontal, holder);
 
 	slider->setRange(0, 1000);
-	slider->setValue(925);
+	slider->setValue(static_cast<int32_t>(defaultSpeed));
 	slider->setTracking(true);
 
 	auto * bottomLayout = new QHBoxLayout();
@@ -306,10 +418,67 @@ void GraphicsScene::populateBottomLayout(QWidget * holder, QGridLayout * mainLay
 	bottomLayout->addSpacing(40);
 	bottomLayout->addWidget(new QLabel("Speed: "));
 	bottomLayout->addWidget(slider);
+
+	// dragging paints walls, or at a cost above the minimum, terrain that weighted searches pay to enter
+	auto * brushBox = new QSpinBox(holder);
+	brushBox->setRange(GridItem::wallBrush, GridModel::maximumCost);
+	brushBox->setSpecialValueText("Wall");
+	brushBox->setPrefix("Cost ");
+	brushBox->setToolTip("Cost of entering a painted cell, for Dijkstra, A*, HPA* and D* Lite. BFS, DFS and JPS ignore costs");
+	m_brushBoxes.push_back(brushBox);
+
+	bottomLayout->addSpacing(40);
+	bottomLayout->addWidget(new QLabel("Brush: "));
+	bottomLayout->addWidget(brushBox);
 	mainLayout->addLayout(bottomLayout, 1, 0);
 
-	connect(slider, &QSlider::valueChanged, this, &GraphicsScene::setDelay);
+	connect(brushBox, &QSpinBox::valueChanged, this, [this](const int32_t brush) {
+		m_gridItem->setBrush(static_cast<uint8_t>(brush));
+
+		// one brush for the shared grid, every tab shows it
+		for(auto * otherBox : m_brushBoxes) {
+			const QSignalBlocker blocker(otherBox);
+			otherBox->setValue(brush);
+		}
+	});
+
+	connect(slider, &QSlider::valueChanged, this, &GraphicsScene::setSpeed);
 	connect(slider, &QSlider::valueChanged, this, &GraphicsScene::animationDurationChanged);
+
+	auto * reverseButton = new PushButton("Reverse", holder);
+	auto * expansionLabel = new QLabel("Expanded : 0", holder);
+	m_expansionLabels.push_back(expansionLabel);
+	auto * timeline = new QSlider(Qt::Horizontal, holder);
+	timeline->setRange(0, 0);
+	timeline->setTracking(true);
+	m_timelines.push_back(timeline);
+
+	auto * timelineLayout = new QHBoxLayout();
+	timelineLayout->addWidget(reverseButton);
+	timelineLayout->addSpacing(40);
+	timelineLayout->addWidget(new QLabel("Timeline: "));
+	timelineLayout->addWidget(timeline);
+	timelineLayout->addSpacing(40);
+	timelineLayout->addWidget(expansionLabel);
+	mainLayout->addLayout(timelineLayout, 2, 0);
+
+	connect(timeline, &QSlider::valueChanged, this, [this](const int32_t position) {
+		seek(static_cast<uint32_t>(position));
+	});
+
+	connect(reverseButton, &QPushButton::released, reverseButton, [this, reverseButton] {
+		m_reverse = !m_reverse;
+		reverseButton->setText(m_reverse ? "Forward" : "Reverse");
+
+		if(m_trace.empty() || m_stepping == Stepping::Replay) {
+			return;
+		}
+
+		// replays the recorded trace the other way, also once the search has finished
+		m_stepping = Stepping::Replay;
+		m_stepBudget = 1;
+		m_clock->requestFrame();
+	});
 }
 
 void GraphicsScene::setRunning(const bool newState) noexcept {
@@ -322,11 +491,10 @@ void GraphicsScene::setRunning(const bool newState) noexcept {
 		enableAllBarTabs();
 	}
 
-	emit runningStatusChanged(m_running); // connected with node class
+	emit runningStatusChanged(m_running); // connected with the grid item
 }
 
-QHBoxLayout * GraphicsScene::getLegendLayout(QWidget * holder, QString token) const noexcept {
-	const QString pattern = R"(:/pixmaps/icons/%1.png)";
+QHBoxLayout * GraphicsScene::getLegendLayout(QWidget * holder, const QString & token, const GridItem::State state) const noexcept {
 	QString labelText = token;
 	labelText[0] = labelText[0].toUpper();
 
@@ -337,262 +505,489 @@ QHBoxLayout * GraphicsScene::getLegendLayout(QWidget * holder, QString token) co
 	layout->addWidget(icon);
 	layout->addWidget(label);
 
-	if(token == "m_visited") {
-		token = "inactive";
-		auto opacityEffect = new QGraphicsOpacityEffect(icon);
-		opacityEffect->setOpacity(0.5);
-		icon->setGraphicsEffect(opacityEffect);
-	} else {
-		addShadowEffect(icon);
-	}
-
+	addShadowEffect(icon);
 	addShadowEffect(label);
 
-	QPixmap pixmap(pattern.arg(token));
-	icon->setPixmap(pixmap);
+	icon->setPixmap(SpriteAtlas::instance().sprite(state));
 	return layout;
 }
 
-Node * GraphicsScene::getNewNode(const size_t row, const size_t col) noexcept {
-	auto * node = new Node(static_cast<uint32_t>(row), static_cast<uint32_t>(col));
+void GraphicsScene::populateGridScene() noexcept {
+	m_gridItem = new GridItem(*m_grid, *m_clock, nodeSpacing());
+	connect(m_gridItem, &GridItem::cellEdited, this, &GraphicsScene::noteEdit);
+	innerScene->setItemIndexMethod(QGraphicsScene::NoIndex); // a single item, nothing to index
+	innerScene->addItem(m_gridItem);
 
-	connect(this, &GraphicsScene::animationDurationChanged, node, &Node::changeAnimationDuration);
+	const uint32_t sourceCell = getRandomCell();
+	uint32_t targetCell;
 
-	connect(node, &Node::sourceSet, [this, node, row, col] {
-		m_sourceNodeCord = {row, col};
-		m_sourceNode = node;
-	});
+	while((targetCell = getRandomCell()) == sourceCell)
+		;
 
-	connect(node, &Node::targetSet, [this, node, row, col] {
-		m_targetNodeCord = {row, col};
-		m_targetNode = node;
-	});
+	m_gridItem->setSource(sourceCell);
+	m_gridItem->setTarget(targetCell);
+}
+
+void GraphicsScene::noteEdit(const uint32_t cell) noexcept {
+	if(cell == GridModel::npos) {
+		m_components->invalidateAll();
+	} else {
+		m_components->invalidate(cell);
+	}
+
+	// past one edit per cell a full rebuild or copy is cheaper than the bookkeeping
+	const auto log = [this, cell](std::vector<uint32_t> & edits) {
+		if(!edits.empty() && edits.front() == GridModel::npos) {
+			return;
+		}
+
+		if(cell == GridModel::npos || edits.size() >= m_grid->cellCount()) {
+			edits.assign(1, GridModel::npos);
+		} else {
+			edits.push_back(cell);
+		}
+	};
+
+	log(m_editedCells);
+	log(m_snapshotEdits);
 
-	return node;
+	if(m_repairLive && !m_repairQueued) {
+		m_repairQueued = true;
+		QTimer::singleShot(0, this, &GraphicsScene::repairSearch);
+	}
 }
 
-void GraphicsScene::populateGridScene() noexcept {
-	auto * holder = new QGraphicsWidget();
-	m_innerLayout = new QGraphicsGridLayout(holder);
+void GraphicsScene::repairSearch() noexcept {
+	m_repairQueued = false;
+
+	// Run pressed, the grid reset or another tab picked since it was posted
+	if(!m_repairLive || m_running || m_bar->currentIndex() != static_cast<int32_t>(TabIndex::DStarLite)) {
+		return;
+	}
+
+	// searchStart hands the logged edits to the solver, which repairs its last search rather than starting over
+	cleanup();
+	memsetDs();
+	searchStart(true);
+}
+
+void GraphicsScene::syncSnapshot() noexcept {
+	// an unchanged grid keeps the snapshot, its component index and a cached distance field, so a run costs the search alone
+	if(m_grid->version() == m_snapshotVersion) {
+		return;
+	}
 
-	holder->setLayout(m_innerLayout);
-	innerScene->addItem(holder);
-	m_innerLayout->setSpacing(25);
+	const bool whole = !m_snapshotEdits.empty() && m_snapshotEdits.front() == GridModel::npos;
 
-	for(size_t row = 0; row < rowCnt; row++) {
-		for(size_t col = 0; col < colCnt; col++) {
-			auto * node = getNewNode(row, col);
-			m_innerLayout->addItem(node, static_cast<int32_t>(row), static_cast<int32_t>(col));
+	if(whole || m_snapshot->rowCount() != m_grid->rowCount() || m_snapshot->colCount() != m_grid->colCount()) {
+		*m_snapshot = *m_grid;
+	} else {
+		for(const auto cell : m_snapshotEdits) {
+			m_snapshot->setBlock(cell, m_grid->isBlock(cell));
+			m_snapshot->setCost(cell, m_grid->cost(cell));
 		}
 	}
 
-	m_sourceNodeCord = getRandomCord();
-	m_targetNodeCord = getRandomCord();
+	m_snapshotEdits.clear();
+	m_snapshotVersion = m_grid->version();
+	m_components->refresh();
+}
 
-	const auto [sourceX, sourceY] = m_sourceNodeCord;
-	const auto [targetX, targetY] = m_targetNodeCord;
+void GraphicsScene::flushEdits() noexcept {
+	// both incremental solvers take the edits at once, so one log serves them and nothing is repaired twice
+	auto * hpaSolver = static_cast<HpaSolver *>(m_solvers[static_cast<size_t>(TabIndex::Hpa)].get());
+	auto * dStarLiteSolver = static_cast<DStarLiteSolver *>(m_solvers[static_cast<size_t>(TabIndex::DStarLite)].get());
 
-	m_sourceNode = getNodeAt(sourceX, sourceY);
-	m_targetNode = getNodeAt(targetX, targetY);
+	for(const auto cell : m_editedCells) {
+		if(cell == GridModel::npos) {
+			hpaSolver->invalidateAll();
+			dStarLiteSolver->invalidateAll();
+		} else {
+			hpaSolver->invalidate(cell);
+			dStarLiteSolver->invalidate(cell);
+		}
+	}
 
-	updateSourceTargetNodes();
+	m_editedCells.clear();
 }
 
 void GraphicsScene::cleanup() const noexcept {
-	for(size_t row = 0; row < rowCnt; row++) {
-		for(size_t col = 0; col < colCnt; col++) {
-			auto * node = getNodeAt(row, col);
-			if(isBlock(node))
-				continue;
-			bool runAnimations = false;
-			node->setType(Node::State::Inactive, runAnimations);
+	constexpr bool clearBlocks = false;
+	m_gridItem->clearStates(clearBlocks);
+}
+
+void GraphicsScene::advanceFrame(qint64, const qint64 delta) noexcept {
+	if(m_stepping == Stepping::Idle) {
+		return; // the worker blocks once the ring is full, so pausing here pauses the search as well
+	}
+
+	if(m_worker.active()) {
+		m_worker.drain(m_trace, maximumDrain);
+	}
+
+	// as many steps as the speed allows for the time this frame covers, the grid item repaints once afterwards
+	m_stepBudget += m_stepsPerSecond * static_cast<double>(std::min(delta, maximumFrameDelta)) / 1000.0;
+	const auto steps = static_cast<uint64_t>(m_stepBudget);
+	m_stepBudget -= static_cast<double>(steps);
+
+	for(uint64_t step = 0; step < steps && m_stepping != Stepping::Idle; step++) {
+		if(m_stepping == Stepping::Replay && !m_reverse && m_replayPosition == m_trace.stepCount() && !m_trace.complete()) {
+			m_stepBudget = 0; // caught up with the worker, wait for the next drain
+			break;
+		}
+
+		const bool proceed = m_stepping == Stepping::Replay ? replayStep() : pathStep();
+
+		if(!proceed) {
+			stopStepping();
 		}
 	}
 
-	updateSourceTargetNodes();
+	if(m_stepping == Stepping::Replay) {
+		updateDistance();
+		updateExpansions();
+		syncTimeline();
+	}
+
+	if(m_stepping != Stepping::Idle) {
+		m_clock->requestFrame();
+	}
 }
 
-void GraphicsScene::pathConnect() const noexcept {
+bool GraphicsScene::pathStep() noexcept {
+	if(m_path.empty()) {
+		return false;
+	}
+
+	const uint32_t cell = m_path.back();
+	m_path.pop_back();
 
-	auto moveUp = [this, currentNode = m_targetNode, newStart = true]() mutable {
-		if(newStart) {
-			currentNode = m_targetNode;
-		}
+	if(!m_gridItem->isSpecial(cell)) {
+		m_gridItem->setState(cell, GridItem::State::Inpath);
+	}
 
-		newStart = false;
+	return true;
+}
+
+bool GraphicsScene::replayStep() noexcept {
+	if(m_pathMarked) {
+		restorePath();
+	}
 
-		if(!currentNode) {
-			newStart = true;
-			return void(pathTimer->stop());
-		} else if(!isSpecial(currentNode)) {
-			currentNode->setType(Node::State::Inpath);
+	if(m_reverse) {
+		if(m_replayPosition == 0) {
+			return false;
 		}
 
-		currentNode = currentNode->getPathParent();
-	};
+		const uint32_t step = --m_replayPosition;
+		applyTraceState(m_trace.cell(step), m_replayPosition, true);
+		applyTraceState(m_trace.parent(step), m_replayPosition, true);
+		return true;
+	}
+
+	if(m_replayPosition == m_trace.stepCount()) {
+		finishReplay();
+		return m_stepping == Stepping::Path;
+	}
 
-	connect(pathTimer.get(), &QTimer::timeout, m_targetNode, moveUp);
+	const uint32_t step = m_replayPosition++;
+	applyTraceState(m_trace.cell(step), m_replayPosition, true);
+	applyTraceState(m_trace.parent(step), m_replayPosition, true);
+	return true;
 }
 
-void GraphicsScene::dfsImplementation() noexcept {
-	auto * infoLine = getStatusBar(static_cast<uint32_t>(TabIndex::Dfs));
+void GraphicsScene::finishReplay() noexcept {
+	m_repairLive = m_traceTab == TabIndex::DStarLite;
+
+	if(!m_traceBidirectional && !m_traceField) {
+		const ExpansionCount count{m_snapshot->version(), m_trace.source(), m_trace.target(), m_trace.stepCount()};
+		m_oneWayExpansions[static_cast<size_t>(m_traceTab)] = count;
+	}
+
+	// replaying the same trace again after a reverse is not another run
+	if(!m_runRecorded) {
+		recordRun();
+	}
+
+	syncTimeline();
+	updateExpansions();
 
-	if(m_stack->empty()) {
-		dfsTimer->stop();
-		infoLine->setText("Could not reach destination.");
+	if(!m_trace.found()) {
+		getStatusBar(static_cast<uint32_t>(m_bar->currentIndex()))->setText("Could not reach destination.");
 		emit resetButtons();
 		return;
 	}
 
-	auto [currentNode, currentDistance] = m_stack->top();
-	m_stack->pop();
-	infoLine->setText(QString("Current Distance : %1").arg(currentDistance));
+	getStatusBar(static_cast<uint32_t>(m_bar->currentIndex()))->setText(QString("Final Distance : %1").arg(m_runs.back().stats.pathCost));
+	m_path = m_trace.path();
+	std::reverse(m_path.begin(), m_path.end());
+	m_pathMarked = true;
+	m_stepping = Stepping::Path;
+	emit foundPath();
+	emit resetButtons();
+}
+
+void GraphicsScene::recordRun() noexcept {
+	RunRecord record;
+	record.tab = m_traceTab;
+	record.bidirectional = m_traceBidirectional;
+	record.variant = m_traceVariant;
+	record.rowCnt = m_snapshot->rowCount();
+	record.colCnt = m_snapshot->colCount();
+	record.stats = m_worker.stats();
+	record.animationSeconds = static_cast<double>(m_animationTimer.elapsed()) / 1000.0;
+	m_runs.push_back(record);
+	m_runRecorded = true;
+
+	const auto & stats = record.stats;
+	const QString text = QString("Expanded : %1\nPushed : %2\nStale pops : %3\nPeak frontier : %4\nPath length : %5\nPath cost : %6\n"
+					     "Solver : %7 ms\nAnimation : %8 s")
+					 .arg(stats.expanded)
+					 .arg(stats.pushed)
+					 .arg(stats.stalePops)
+					 .arg(stats.peakFrontier)
+					 .arg(stats.pathLength)
+					 .arg(stats.pathCost)
+					 .arg(stats.solverSeconds * 1000.0, 0, 'f', 2)
+					 .arg(record.animationSeconds, 0, 'f', 2);
+
+	m_statsLabels[static_cast<size_t>(m_traceTab)]->setText(text);
+}
+
+void GraphicsScene::saveMap() noexcept {
+	const QString fileName = QFileDialog::getSaveFileName(nullptr, "Save grid", "grid.pvgrid", "Grid (*.pvgrid)");
 
-	if(!isSpecial(currentNode)) {
-		currentNode->setType(Node::State::Active);
+	if(!fileName.isEmpty() && !saveGrid(*m_grid, fileName.toStdString())) {
+		QMessageBox::warning(nullptr, "Save", QString("Could not write %1.").arg(fileName));
 	}
+}
 
-	if(currentNode == m_targetNode) {
-		dfsTimer->stop();
-		emit foundPath();
-		emit resetButtons();
+void GraphicsScene::loadMap() noexcept {
+	const QString fileName = QFileDialog::getOpenFileName(nullptr, "Load grid", QString(), "Grids (*.pvgrid *.map);;All files (*)");
+
+	if(fileName.isEmpty()) {
 		return;
 	}
 
-	auto [curX, curY] = currentNode->getCord();
-	auto * nodeParent = currentNode->getPathParent();
+	const auto grid = loadGrid(fileName.toStdString());
 
-	if(nodeParent && !isSpecial(nodeParent)) {
-		nodeParent->setType(Node::State::Visited);
+	if(!grid) {
+		QMessageBox::warning(nullptr, "Load", QString("Could not read a grid from %1.").arg(fileName));
+	} else if(grid->rowCount() != m_rowCnt || grid->colCount() != m_colCnt) {
+		// GridItem and the solvers are laid out once for the dimensions the scene was started with
+		const QString text = QString("%1 has %2 x %3 cells, start with --map to open it.").arg(fileName);
+		QMessageBox::warning(nullptr, "Load", text.arg(grid->rowCount()).arg(grid->colCount()));
+	} else {
+		setGrid(*grid);
 	}
+}
 
-	for(uint32_t direction = 0; direction < 4; direction++) {
-		const auto toRow = static_cast<ptrdiff_t>(curX) + xCord[direction];
-		const auto toCol = static_cast<ptrdiff_t>(curY) + yCord[direction];
+void GraphicsScene::exportRuns() noexcept {
+	if(m_runs.empty()) {
+		QMessageBox::information(nullptr, "Export", "No run has finished yet.");
+		return;
+	}
 
-		if(validCordinate(toRow, toCol)) {
-			const auto validRow = static_cast<size_t>(toRow);
-			const auto validCol = static_cast<size_t>(toCol);
-			auto * togoNode = getNodeAt(validRow, validCol);
+	const QString fileName = QFileDialog::getSaveFileName(nullptr, "Export statistics", "searchStats.json", "JSON (*.json)");
 
-			if(isBlock(togoNode) || (*m_visited)[validRow][validCol])
-				continue;
+	if(fileName.isEmpty()) {
+		return;
+	}
 
-			(*m_visited)[validRow][validCol] = true;
-			togoNode->setPathParent(currentNode);
-			m_stack->push({togoNode, currentDistance + 1});
-		}
+	QJsonArray runs;
+
+	for(const auto & record : m_runs) {
+		const auto & stats = record.stats;
+		QJsonObject run;
+		run["algorithm"] = m_bar->tabText(static_cast<int32_t>(record.tab));
+		run["bidirectional"] = record.bidirectional;
+		run["variant"] = record.variant;
+		run["rows"] = static_cast<qint64>(record.rowCnt);
+		run["cols"] = static_cast<qint64>(record.colCnt);
+		run["expanded"] = static_cast<qint64>(stats.expanded);
+		run["pushed"] = static_cast<qint64>(stats.pushed);
+		run["stalePops"] = static_cast<qint64>(stats.stalePops);
+		run["peakFrontier"] = static_cast<qint64>(stats.peakFrontier);
+		run["pathLength"] = static_cast<qint64>(stats.pathLength);
+		run["pathCost"] = static_cast<qint64>(stats.pathCost);
+		run["solverSeconds"] = stats.solverSeconds;
+		run["animationSeconds"] = record.animationSeconds;
+		runs.append(run);
 	}
-}
 
-void GraphicsScene::bfsImplementation() noexcept {
-	auto * infoLine = getStatusBar(static_cast<uint32_t>(TabIndex::Bfs));
+	QFile file(fileName);
 
-	if(m_queue->empty()) {
-		bfsTimer->stop();
-		infoLine->setText("Could not reach destination.");
-		emit resetButtons();
+	if(!file.open(QFile::WriteOnly | QFile::Truncate)) {
+		QMessageBox::warning(nullptr, "Export", QString("Could not write %1.").arg(fileName));
 		return;
 	}
 
-	auto [currentNode, currentDistance] = m_queue->front();
-	m_queue->pop();
-	auto [curX, curY] = currentNode->getCord();
+	file.write(QJsonDocument(runs).toJson());
+}
+
+void GraphicsScene::seek(const uint32_t position) noexcept {
+	if(m_trace.empty()) {
+		return;
+	}
 
-	if(!isSpecial(currentNode)) {
-		currentNode->setType(Node::State::Active);
+	if(m_pathMarked) {
+		restorePath();
 	}
 
-	auto nodeParent = currentNode->getPathParent();
+	const uint32_t target = std::min(position, m_trace.stepCount());
+	const uint32_t first = std::min(target, m_replayPosition);
+	const uint32_t last = std::max(target, m_replayPosition);
 
-	if(nodeParent && !isSpecial(nodeParent)) {
-		nodeParent->setType(Node::State::Visited);
+	// phases are absolute, so only the cells touched by the skipped steps need repainting, either direction
+	for(uint32_t step = first; step < last; step++) {
+		applyTraceState(m_trace.cell(step), target, false);
+		applyTraceState(m_trace.parent(step), target, false);
 	}
 
-	infoLine->setText(QString("Current Distance : %1").arg(currentDistance));
+	m_replayPosition = target;
+	updateDistance();
+	updateExpansions();
+}
 
-	if(currentNode == m_targetNode) {
-		bfsTimer->stop();
-		emit foundPath();
-		emit resetButtons();
+void GraphicsScene::applyTraceState(const uint32_t cell, const uint32_t position, const bool runAnimations) noexcept {
+	if(cell == GridModel::npos || m_gridItem->isSpecial(cell)) {
 		return;
 	}
 
-	for(uint32_t direction = 0; direction < 4; direction++) {
-		const auto toRow = static_cast<ptrdiff_t>(curX) + xCord[direction];
-		const auto toCol = static_cast<ptrdiff_t>(curY) + yCord[direction];
+	switch(m_trace.phaseAt(cell, position)) {
+	case SearchTrace::Phase::Unseen:
+		m_gridItem->setState(cell, GridItem::State::Inactive, runAnimations);
+		break;
+	case SearchTrace::Phase::Active:
+		m_gridItem->setState(cell, GridItem::State::Active, runAnimations, m_trace.parent(m_trace.popStep(cell, position)));
+		break;
+	case SearchTrace::Phase::Visited: {
+		// every expansion of a jump point search is a jump point, keep them apart from the cells it skipped. HPA* entrances alike
+		const bool sparse = m_traceTab == TabIndex::Jps || m_traceTab == TabIndex::Hpa;
+		const auto visited = sparse ? GridItem::State::JumpPoint : GridItem::State::Visited;
+		m_gridItem->setState(cell, visited, runAnimations);
+		break;
+	}
+	default:
+		__builtin_unreachable();
+	}
+}
 
-		if(validCordinate(toRow, toCol)) {
-			const auto validRow = static_cast<size_t>(toRow);
-			const auto validCol = static_cast<size_t>(toCol);
+void GraphicsScene::restorePath() noexcept {
+	for(const auto cell : m_trace.path()) {
+		applyTraceState(cell, m_replayPosition, false);
+	}
 
-			auto * togoNode = getNodeAt(validRow, validCol);
+	m_path.clear();
+	m_pathMarked = false;
 
-			if(isBlock(togoNode) || (*m_visited)[validRow][validCol])
-				continue;
+	if(m_stepping == Stepping::Path) {
+		m_stepping = Stepping::Idle;
+	}
+}
 
-			(*m_visited)[validRow][validCol] = true;
-			togoNode->setPathParent(currentNode);
-			m_queue->push({togoNode, currentDistance + 1});
-		}
+void GraphicsScene::syncTimeline() const noexcept {
+	if(m_timelines.empty()) {
+		return;
 	}
+
+	auto * timeline = m_timelines[static_cast<size_t>(m_bar->currentIndex())];
+	const QSignalBlocker blocker(timeline);
+	timeline->setRange(0, static_cast<int32_t>(m_trace.stepCount()));
+	timeline->setValue(static_cast<int32_t>(m_replayPosition));
 }
 
-void GraphicsScene::dijkstraImplementation() noexcept {
-	auto * infoLine = getStatusBar(static_cast<uint32_t>(TabIndex::Dijkstra));
+void GraphicsScene::updateDistance() const noexcept {
+	const uint32_t distance = m_replayPosition ? m_trace.distance(m_replayPosition - 1) : 0;
+	getStatusBar(static_cast<uint32_t>(m_bar->currentIndex()))->setText(QString("Current Distance : %1").arg(distance));
+}
 
-	if(m_priorityQueue->empty()) {
-		dijkstraTimer->stop();
-		infoLine->setText("Could not reach destination.");
-		emit resetButtons();
+void GraphicsScene::updateExpansions() const noexcept {
+	if(m_expansionLabels.empty()) {
 		return;
 	}
 
-	auto [currentDistance, currentNode] = m_priorityQueue->top();
-	m_priorityQueue->pop();
-	auto [curX, curY] = currentNode->getCord();
+	QString text = QString("Expanded : %1").arg(m_replayPosition);
 
-	if((*m_distance)[curX][curY] != currentDistance)
-		return;
+	// savings only show next to the plain search of the same query: one way for bidirectional runs, Dijkstra for informed ones
+	const bool informed = m_traceField || m_traceTab == TabIndex::AStar || m_traceTab == TabIndex::Jps || m_traceTab == TabIndex::Hpa ||
+				    m_traceTab == TabIndex::DStarLite;
 
-	if(!isSpecial(currentNode)) {
-		currentNode->setType(Node::State::Active);
+	if(const uint32_t oneWay = comparableExpansions(m_traceTab); m_traceBidirectional && oneWay != GridModel::npos) {
+		text += QString("   One way : %1").arg(oneWay);
+	} else if(const uint32_t dijkstra = comparableExpansions(TabIndex::Dijkstra); informed && dijkstra != GridModel::npos) {
+		text += QString("   Dijkstra : %1").arg(dijkstra);
 	}
-	auto nodeParent = currentNode->getPathParent();
 
-	if(nodeParent && !isSpecial(nodeParent)) {
-		nodeParent->setType(Node::State::Visited);
-	}
+	m_expansionLabels[static_cast<size_t>(m_bar->currentIndex())]->setText(text);
+}
 
-	infoLine->setText(QString("Current Distance: %1").arg(currentDistance));
+uint32_t GraphicsScene::comparableExpansions(const TabIndex tab) const noexcept {
+	// edits and moved endpoints after that run leave its count in place, it just stops matching
+	const auto & [version, source, target, expansions] = m_oneWayExpansions[static_cast<size_t>(tab)];
+	const bool sameQuery = version == m_snapshot->version() && source == m_trace.source() && target == m_trace.target();
+	return sameQuery ? expansions : GridModel::npos;
+}
 
-	if(currentNode == m_targetNode) {
-		dijkstraTimer->stop();
-		emit foundPath();
-		emit resetButtons();
-		return;
+void GraphicsScene::populateHeuristicBox(QWidget * holder) noexcept {
+	auto * sideLayout = static_cast<QVBoxLayout *>(static_cast<QGridLayout *>(holder->layout())->itemAtPosition(0, 1)->layout());
+	auto * heuristicLabel = new QLabel("Heuristic:", holder);
+	auto * heuristicBox = new QComboBox(holder);
+
+	for(const auto * name : heuristicNames) {
+		heuristicBox->addItem(name);
 	}
 
-	for(uint32_t direction = 0; direction < 4; direction++) {
-		const auto toRow = static_cast<ptrdiff_t>(curX) + xCord[direction];
-		const auto toCol = static_cast<ptrdiff_t>(curY) + yCord[direction];
+	heuristicBox->setCurrentIndex(static_cast<int32_t>(m_heuristic));
 
-		if(validCordinate(toRow, toCol)) {
-			const auto validRow = static_cast<size_t>(toRow);
-			const auto validCol = static_cast<size_t>(toCol);
-			auto * togoNode = getNodeAt(validRow, validCol);
+	sideLayout->addSpacing(25);
+	sideLayout->addWidget(heuristicLabel);
+	sideLayout->addWidget(heuristicBox);
+	addShadowEffect(heuristicLabel);
 
-			if(isBlock(togoNode))
-				continue;
+	connect(heuristicBox, &QComboBox::currentIndexChanged, this, [this](const int32_t index) {
+		m_heuristic = static_cast<Heuristic>(index); // applied by the next run
+	});
+}
 
-			uint32_t & destDistance = (*m_distance)[validRow][validCol];
-			const auto newDistance = currentDistance + 1;
+void GraphicsScene::populateQueueBox(QWidget * holder) noexcept {
+	auto * sideLayout = static_cast<QVBoxLayout *>(static_cast<QGridLayout *>(holder->layout())->itemAtPosition(0, 1)->layout());
+	auto * queueLabel = new QLabel("Queue:", holder);
+	auto * queueBox = new QComboBox(holder);
 
-			if(newDistance < destDistance) {
-				destDistance = newDistance;
-				togoNode->setPathParent(currentNode);
-				m_priorityQueue->push({newDistance, togoNode});
-			}
-		}
+	for(const auto * name : queueNames) {
+		queueBox->addItem(name);
 	}
-}
\ No newline at end of file
+
+	queueBox->setCurrentIndex(static_cast<int32_t>(m_queueBackend));
+	queueBox->setToolTip("Priority queue of the one way search. the 4-ary heap keeps one entry per cell, the others skip stale ones");
+
+	sideLayout->addSpacing(25);
+	sideLayout->addWidget(queueLabel);
+	sideLayout->addWidget(queueBox);
+	addShadowEffect(queueLabel);
+
+	connect(queueBox, &QComboBox::currentIndexChanged, this, [this](const int32_t index) {
+		m_queueBackend = static_cast<QueueBackend>(index); // applied by the next run
+	});
+}
+
+void GraphicsScene::populateBidirectionalBox(QWidget * holder) noexcept {
+	auto * sideLayout = static_cast<QVBoxLayout *>(static_cast<QGridLayout *>(holder->layout())->itemAtPosition(0, 1)->layout());
+	auto * bidirectionalBox = new QCheckBox("Bidirectional", holder);
+	bidirectionalBox->setToolTip("Search from both ends and meet in the middle, applied by the next run");
+
+	sideLayout->addSpacing(25);
+	sideLayout->addWidget(bidirectionalBox);
+	m_bidirectionalBoxes.back() = bidirectionalBox;
+}
+
+void GraphicsScene::populateFieldBox(QWidget * holder) noexcept {
+	auto * sideLayout = static_cast<QVBoxLayout *>(static_cast<QGridLayout *>(holder->layout())->itemAtPosition(0, 1)->layout());
+	m_fieldBox = new QCheckBox("Keep distance field", holder);
+	m_fieldBox->setToolTip("Flood the whole grid once from the source, then answer later targets from the same field while the source "
+			       "and the grid stay unchanged. overrides Bidirectional and the queue");
+
+	sideLayout->addSpacing(25);
+	sideLayout->addWidget(m_fieldBox);
+}
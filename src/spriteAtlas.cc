@@ -0,0 +1,55 @@
+#include <QPainter>
+#include <QImage>
+#include "spriteAtlas.h"
+
+SpriteAtlas::SpriteAtlas() {
+	const QString pattern = R"(:/pixmaps/icons/%1.png)";
+	std::array<QString, GridItem::stateCount> iconNames;
+
+	iconNames[static_cast<size_t>(GridItem::State::Source)] = "source";
+	iconNames[static_cast<size_t>(GridItem::State::Target)] = "target";
+	iconNames[static_cast<size_t>(GridItem::State::Active)] = "active";
+	iconNames[static_cast<size_t>(GridItem::State::Inactive)] = "inactive";
+	iconNames[static_cast<size_t>(GridItem::State::Visited)] = "inactive";
+	iconNames[static_cast<size_t>(GridItem::State::Block)] = "block";
+	iconNames[static_cast<size_t>(GridItem::State::Inpath)] = "inpath";
+	iconNames[static_cast<size_t>(GridItem::State::JumpPoint)] = "inactive";
+
+	QImage sheet(rotationCount * dimension, static_cast<int32_t>(GridItem::stateCount) * dimension, QImage::Format_ARGB32_Premultiplied);
+	sheet.fill(Qt::transparent);
+
+	QPainter painter(&sheet);
+	painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+	for(size_t state = 0; state < GridItem::stateCount; state++) {
+		const QImage icon = QImage(pattern.arg(iconNames[state])).scaled(dimension, dimension, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+		const auto cellState = static_cast<GridItem::State>(state);
+
+		// visited cells are drawn at half opacity, bake it in rather than switching painter opacity per cell
+		painter.setOpacity(cellState == GridItem::State::Visited ? 0.5 : 1);
+
+		for(uint8_t rotation = 0; rotation < rotationCount; rotation++) {
+			painter.save();
+			painter.translate(sourceRect(cellState, rotation).center());
+			painter.rotate(rotations[rotation]);
+			painter.drawImage(QPointF(-dimension / 2, -dimension / 2), icon);
+			painter.restore();
+		}
+
+		const QImage pixel = icon.scaled(1, 1, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+		m_flatColors[state] = pixel.pixel(0, 0);
+
+		if(cellState == GridItem::State::JumpPoint) {
+			// no icon of its own, the inactive one tinted over its opaque pixels only
+			const QRectF row(0, static_cast<qreal>(state) * dimension, rotationCount * dimension, dimension);
+			painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
+			painter.fillRect(row, jumpPointTint);
+			painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+			m_flatColors[state] = jumpPointTint.rgb();
+		}
+	}
+
+	painter.end();
+	m_sheet = QPixmap::fromImage(sheet);
+	m_flatColors[static_cast<size_t>(GridItem::State::Visited)] = QColor(flatColor(GridItem::State::Visited)).lighter(150).rgb();
+}
@@ -0,0 +1,75 @@
+#include "core/componentIndex.h"
+#include "testSupport.h"
+
+// the components of index after refresh() match those of fresh, built from scratch on the same grid, cell for cell: blocks in
+// none, open cells grouped the same way
+static void expectSameComponents(ComponentIndex & index, ComponentIndex & fresh, const GridModel & grid) {
+	std::vector<uint32_t> toIndex(grid.cellCount(), GridModel::npos); // fresh component to the one of index
+	std::vector<uint32_t> toFresh(grid.cellCount(), GridModel::npos);
+
+	for(uint32_t cell = 0; cell < grid.cellCount(); cell++) {
+		const uint32_t root = index.component(cell);
+		const uint32_t freshRoot = fresh.component(cell);
+
+		if(!EXPECT((root == GridModel::npos) == grid.isBlock(cell) && (freshRoot == GridModel::npos) == grid.isBlock(cell))) {
+			continue;
+		}
+
+		if(root == GridModel::npos) {
+			continue;
+		}
+
+		if(toIndex[freshRoot] == GridModel::npos && toFresh[root] == GridModel::npos) {
+			toIndex[freshRoot] = root;
+			toFresh[root] = freshRoot;
+		}
+
+		EXPECT(toIndex[freshRoot] == root && toFresh[root] == freshRoot);
+	}
+}
+
+// random closures and openings, reported one by one or in batches, keep connected() equal to a full rebuild. densities
+// around the percolation threshold make closures that split a component common, long corridors overrun the local flood
+int main() {
+	std::mt19937 generator(11);
+	uint64_t edits = 0;
+	uint64_t rebuilds = 0;
+
+	for(int map = 0; map < 18; map++) {
+		GridModel grid = randomGrid(24 + map % 3 * 20, 32 + map % 2 * 40, 0.1 + map % 6 * 0.08, 1, generator);
+		ComponentIndex index(grid);
+		index.refresh();
+		std::uniform_int_distribution<uint32_t> cellDist(0, grid.cellCount() - 1);
+		const uint64_t initialRebuilds = index.rebuilds();
+
+		for(int round = 0; round < 60; round++) {
+			const uint32_t batch = round % 4 ? 1 : 1 + generator() % 12;
+
+			for(uint32_t edit = 0; edit < batch; edit++) {
+				const uint32_t cell = cellDist(generator);
+				grid.setBlock(cell, !grid.isBlock(cell));
+				index.invalidate(cell);
+				edits++;
+			}
+
+			index.refresh();
+			ComponentIndex fresh(grid);
+			fresh.refresh();
+
+			for(int query = 0; query < 32; query++) {
+				const uint32_t first = cellDist(generator);
+				const uint32_t second = generator() % 4 ? cellDist(generator) : first;
+				EXPECT(index.connected(first, second) == fresh.connected(first, second));
+			}
+
+			expectSameComponents(index, fresh, grid);
+		}
+
+		rebuilds += index.rebuilds() - initialRebuilds;
+	}
+
+	// most edits have to be applied in place, or the comparison above only exercised rebuild()
+	EXPECT(rebuilds < edits / 4);
+
+	return testResult();
+}
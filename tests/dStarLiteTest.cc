@@ -0,0 +1,54 @@
+#include "core/dStarLiteSolver.h"
+#include "testSupport.h"
+
+// D* Lite keeps its values across runs and repairs them after edits, every repaired answer has to equal a fresh Dijkstra
+int main() {
+	std::mt19937 generator(11);
+	uint32_t repairs = 0;
+
+	for(int map = 0; map < 20; map++) {
+		GridModel grid = randomGrid(24 + map % 5 * 7, 40 - map % 3 * 9, 0.25, 9, generator);
+		DStarLiteSolver solver(grid);
+		uint32_t source = randomOpenCell(grid, generator);
+		uint32_t target = randomOpenCell(grid, generator);
+
+		for(int round = 0; round < 30; round++) {
+			solver.start(source, target);
+			solver.run();
+
+			const uint32_t expected = shortestDistance(grid, source, target);
+			const bool found = solver.status() == SearchSolver::Status::Found;
+			EXPECT(found == (expected != GridModel::npos));
+
+			if(found) {
+				EXPECT(solver.currentDistance() == expected);
+				EXPECT(pathCost(grid, solver.path(), source, target) == expected);
+			}
+
+			repairs += solver.repaired();
+
+			// edits around the search, now and then a moved source and rarely a new target which starts over
+			editRandomCells(grid, 1 + generator() % 12, generator, [&](const uint32_t cell) { solver.invalidate(cell); });
+
+			if(generator() % 3 == 0) {
+				source = randomOpenCell(grid, generator);
+			}
+
+			if(generator() % 10 == 0) {
+				target = randomOpenCell(grid, generator);
+			}
+
+			// the endpoints are open for the next run, the edit that opens them is reported like any other
+			for(const uint32_t cell : {source, target}) {
+				if(grid.isBlock(cell)) {
+					grid.setBlock(cell, false);
+					solver.invalidate(cell);
+				}
+			}
+		}
+	}
+
+	// most runs have to be repairs, or the test only covered fresh searches
+	EXPECT(repairs > 20 * 30 / 2);
+	return testResult();
+}
@@ -0,0 +1,49 @@
+#include "core/hpaSolver.h"
+#include "testSupport.h"
+
+// HPA* answers are valid routes found exactly when one exists, at most a couple of clusters worse than the optimum, and
+// a solver that rebuilt the clusters touched by edits has to answer like one built from scratch on the edited grid
+int main() {
+	std::mt19937 generator(5);
+	uint64_t rebuilt = 0;
+
+	for(int map = 0; map < 24; map++) {
+		const uint32_t clusterSize = 8 + map % 3 * 4;
+		const uint8_t maxCost = map % 2 ? 9 : 1;
+		GridModel grid = randomGrid(40 + map % 4 * 23, 50 + map % 3 * 31, 0.2 + map % 3 * 0.08, maxCost, generator);
+		HpaSolver solver(grid, clusterSize);
+
+		for(int round = 0; round < 12; round++) {
+			HpaSolver fresh(grid, clusterSize);
+
+			for(int query = 0; query < 8; query++) {
+				const uint32_t source = randomOpenCell(grid, generator);
+				const uint32_t target = randomOpenCell(grid, generator);
+				const uint32_t expected = shortestDistance(grid, source, target);
+				solver.start(source, target);
+				solver.run();
+				fresh.start(source, target);
+				fresh.run();
+
+				const bool found = solver.status() == SearchSolver::Status::Found;
+				EXPECT(found == (expected != GridModel::npos));
+				EXPECT(fresh.status() == solver.status());
+
+				if(found) {
+					// the route is bound to cross borders at entrances, each crossing may cost a detour along the border
+					EXPECT(solver.currentDistance() >= expected);
+					EXPECT(solver.currentDistance() <= expected + 2 * clusterSize * maxCost);
+					EXPECT(pathCost(grid, solver.path(), source, target) == solver.currentDistance());
+					EXPECT(fresh.currentDistance() == solver.currentDistance());
+				}
+			}
+
+			editRandomCells(grid, 1 + generator() % 16, generator, [&](const uint32_t cell) { solver.invalidate(cell); });
+		}
+
+		rebuilt += solver.rebuiltClusters();
+	}
+
+	EXPECT(rebuilt > 0);
+	return testResult();
+}
@@ -0,0 +1,149 @@
+#include <sstream>
+#include "core/dStarLiteSolver.h"
+#include "testSupport.h"
+
+// D* Lite repairs pop cells again, the trace of a repair has to survive a round trip and seek to the pop in effect
+static bool repopsCell(const SearchTrace & trace) {
+	for(uint32_t step = 0; step < trace.stepCount(); step++) {
+		if(trace.popStep(trace.cell(step), trace.stepCount()) != step) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void expectEqual(const SearchTrace & read, const SearchTrace & written) {
+	EXPECT(read.complete());
+	EXPECT(read.found() == written.found());
+	EXPECT(read.path() == written.path());
+	EXPECT(read.source() == written.source() && read.target() == written.target());
+	EXPECT(read.stepCount() == written.stepCount() && read.pushCount() == written.pushCount());
+
+	for(uint32_t step = 0; step < written.stepCount(); step++) {
+		EXPECT(read.cell(step) == written.cell(step) && read.parent(step) == written.parent(step));
+		EXPECT(read.distance(step) == written.distance(step) && read.pushes(step).second - read.pushes(step).first ==
+													  written.pushes(step).second - written.pushes(step).first);
+	}
+
+	for(uint32_t cell = 0; cell < written.rowCount() * written.colCount(); cell++) {
+		EXPECT(read.isBlock(cell) == written.isBlock(cell));
+		EXPECT(read.popStep(cell, written.stepCount()) == written.popStep(cell, written.stepCount()));
+	}
+}
+
+static void expectSeekable(const SearchTrace & trace) {
+	for(uint32_t step = 0; step < trace.stepCount(); step++) {
+		const uint32_t cell = trace.cell(step);
+
+		// the pop in effect right after step is step itself, before it the previous pop of the cell
+		EXPECT(trace.popStep(cell, step + 1) == step);
+		EXPECT(trace.phaseAt(cell, step + 1) != SearchTrace::Phase::Unseen);
+
+		if(const uint32_t previous = trace.popStep(cell, step); previous != GridModel::npos) {
+			EXPECT(previous < step && trace.cell(previous) == cell);
+		} else {
+			EXPECT(trace.phaseAt(cell, step) == SearchTrace::Phase::Unseen);
+		}
+	}
+}
+
+int main() {
+	std::mt19937 generator(7);
+	bool repopped = false;
+
+	for(int round = 0; round < 40; round++) {
+		GridModel grid = randomGrid(32, 48, 0.25, 9, generator);
+		DStarLiteSolver solver(grid);
+		SearchTrace trace;
+		solver.setTrace(&trace);
+
+		const uint32_t source = randomOpenCell(grid, generator);
+		const uint32_t target = randomOpenCell(grid, generator);
+		solver.start(source, target);
+		solver.run();
+
+		// close cells along the path and open some walls, then repair
+		const auto path = solver.path();
+
+		for(size_t index = 1; index + 1 < path.size(); index += 3) {
+			grid.setBlock(path[index], true);
+			solver.invalidate(path[index]);
+		}
+
+		for(int edit = 0; edit < 20; edit++) {
+			const uint32_t cell = std::uniform_int_distribution<uint32_t>(0, grid.cellCount() - 1)(generator);
+			grid.setBlock(cell, false);
+			solver.invalidate(cell);
+		}
+
+		solver.start(source, target);
+		solver.run();
+		EXPECT(solver.repaired());
+		repopped = repopped || repopsCell(trace);
+		expectSeekable(trace);
+
+		std::stringstream stream;
+		EXPECT(trace.write(stream));
+		const std::string bytes = stream.str();
+
+		SearchTrace read;
+		std::istringstream input(bytes);
+		EXPECT(read.read(input));
+		expectEqual(read, trace);
+		expectSeekable(read);
+
+		// a truncated stream is rejected whole
+		std::istringstream truncated(bytes.substr(0, bytes.size() - 1));
+		EXPECT(!read.read(truncated) && read.empty());
+	}
+
+	// the round trips above have to cover a cell popped twice
+	EXPECT(repopped);
+
+	// a second search of an unchanged grid reuses the blocks of the first and has to record the same as a fresh trace
+	for(int round = 0; round < 10; round++) {
+		const GridModel grid = randomGrid(24, 40, 0.3, 1, generator);
+		BfsSolver solver(grid);
+		SearchTrace reused;
+		solver.setTrace(&reused);
+		solver.start(randomOpenCell(grid, generator), randomOpenCell(grid, generator));
+		solver.run();
+
+		SearchTrace fresh;
+		const uint32_t source = randomOpenCell(grid, generator);
+		const uint32_t target = randomOpenCell(grid, generator);
+		solver.start(source, target);
+		solver.run();
+		solver.setTrace(&fresh);
+		solver.start(source, target);
+		solver.run();
+		expectEqual(reused, fresh);
+		expectSeekable(reused);
+
+		for(uint32_t cell = 0; cell < grid.cellCount(); cell++) {
+			for(const uint32_t step : {0u, reused.stepCount() / 2, reused.stepCount()}) {
+				EXPECT(reused.phaseAt(cell, step) == fresh.phaseAt(cell, step));
+			}
+		}
+	}
+
+	// a header claiming more steps than the stream holds fails on the missing data. the step count follows magic, version,
+	// dimensions, endpoints and the found byte
+	std::stringstream stream;
+	SearchTrace trace;
+	GridModel grid(4, 4);
+	DStarLiteSolver solver(grid);
+	solver.setTrace(&trace);
+	solver.start(0, 15);
+	solver.run();
+	EXPECT(trace.write(stream));
+	std::string bytes = stream.str();
+	const uint32_t stepCnt = UINT32_MAX;
+	bytes.replace(6 * sizeof(uint32_t) + sizeof(uint8_t), sizeof(stepCnt), reinterpret_cast<const char *>(&stepCnt), sizeof(stepCnt));
+	std::istringstream corrupt(bytes);
+	SearchTrace read;
+	EXPECT(!read.read(corrupt) && read.empty());
+
+	return testResult();
+}
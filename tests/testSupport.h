@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "core/searchSolver.h"
+
+// shared by the pathCore test executables. a failed EXPECT is reported and the executable exits with failure once its
+// checks ran, so one run shows every broken case
+#define EXPECT(condition) expect(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+inline int & failureCount() noexcept {
+	static int failures = 0;
+	return failures;
+}
+
+inline bool expect(const bool condition, const char * text, const char * file, const int line) noexcept {
+	if(!condition) {
+		std::fprintf(stderr, "%s:%d: expected %s\n", file, line, text);
+		failureCount()++;
+	}
+
+	return condition;
+}
+
+inline int testResult() noexcept {
+	return failureCount() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// blocks with probability density, open cells cost uniformly from minimumCost to maxCost
+inline GridModel randomGrid(const uint32_t rowCnt, const uint32_t colCnt, const double density, const uint8_t maxCost,
+				    std::mt19937 & generator) {
+	GridModel grid(rowCnt, colCnt);
+	std::bernoulli_distribution blockDist(density);
+	std::uniform_int_distribution<uint32_t> costDist(GridModel::minimumCost, maxCost);
+
+	for(uint32_t cell = 0; cell < grid.cellCount(); cell++) {
+		grid.setBlock(cell, blockDist(generator));
+		grid.setCost(cell, static_cast<uint8_t>(costDist(generator)));
+	}
+
+	return grid;
+}
+
+// an open cell drawn uniformly, GridModel::npos if none turned up
+inline uint32_t randomOpenCell(const GridModel & grid, std::mt19937 & generator) {
+	std::uniform_int_distribution<uint32_t> cellDist(0, grid.cellCount() - 1);
+
+	for(uint32_t attempt = 0; attempt < 16 * grid.cellCount(); attempt++) {
+		if(const uint32_t cell = cellDist(generator); !grid.isBlock(cell)) {
+			return cell;
+		}
+	}
+
+	return GridModel::npos;
+}
+
+// cost of path when it is a walk from source to target over open neighbouring cells, paying GridModel::cost() of every
+// cell entered. UINT64_MAX for anything else
+inline uint64_t pathCost(const GridModel & grid, const std::vector<uint32_t> & path, const uint32_t source, const uint32_t target) {
+	if(path.empty() || path.front() != source || path.back() != target) {
+		return UINT64_MAX;
+	}
+
+	uint64_t cost = 0;
+
+	for(size_t index = 1; index < path.size(); index++) {
+		const auto [row, col] = grid.getCord(path[index]);
+		const auto [previousRow, previousCol] = grid.getCord(path[index - 1]);
+		const uint32_t rowGap = std::max(row, previousRow) - std::min(row, previousRow);
+		const uint32_t colGap = std::max(col, previousCol) - std::min(col, previousCol);
+
+		if(path[index] >= grid.cellCount() || rowGap + colGap != 1 || grid.isBlock(path[index])) {
+			return UINT64_MAX;
+		}
+
+		cost += grid.cost(path[index]);
+	}
+
+	return cost;
+}
+
+// distance from a fresh DijkstraSolver, GridModel::npos if target is unreachable
+inline uint32_t shortestDistance(const GridModel & grid, const uint32_t source, const uint32_t target) {
+	DijkstraSolver solver(grid);
+	solver.start(source, target);
+	return solver.run() == SearchSolver::Status::Found ? solver.currentDistance() : GridModel::npos;
+}
+
+// a few cells blocked, opened or repainted at random, each reported to report
+template<typename Report>
+void editRandomCells(GridModel & grid, const uint32_t editCnt, std::mt19937 & generator, Report && report) {
+	std::uniform_int_distribution<uint32_t> cellDist(0, grid.cellCount() - 1);
+	std::uniform_int_distribution<uint32_t> costDist(GridModel::minimumCost, 9);
+
+	for(uint32_t edit = 0; edit < editCnt; edit++) {
+		const uint32_t cell = cellDist(generator);
+
+		switch(generator() % 3) {
+		case 0:
+			grid.setBlock(cell, true);
+			break;
+		case 1:
+			grid.setBlock(cell, false);
+			break;
+		default:
+			grid.setCost(cell, static_cast<uint8_t>(costDist(generator)));
+		}
+
+		report(cell);
+	}
+}
@@ -0,0 +1,78 @@
+#include <unistd.h>
+#include <filesystem>
+#include <thread>
+#include "core/gridFile.h"
+#include "testSupport.h"
+
+static void expectSameCells(const GridModel & read, const GridModel & written) {
+	EXPECT(read.rowCount() == written.rowCount() && read.colCount() == written.colCount());
+
+	for(uint32_t cell = 0; cell < written.cellCount(); cell++) {
+		EXPECT(read.isBlock(cell) == written.isBlock(cell) && read.cost(cell) == written.cost(cell));
+	}
+}
+
+// a grid round trips through a .pvtiles file with only a few tiles resident, edge tiles cut short included, and copies of
+// the tiled grid read through stores of their own so each can be searched on its own thread
+int main() {
+	std::mt19937 generator(13);
+	const auto path = std::filesystem::temp_directory_path() / ("tiledStoreTest-" + std::to_string(getpid()) + ".pvtiles");
+	const GridModel grid = randomGrid(3 * TiledStore::tileSize + 17, 2 * TiledStore::tileSize + 51, 0.3, 9, generator);
+	EXPECT(saveTiledGrid(grid, path.string()));
+
+	const auto tiled = openTiledGrid(path.string(), 2);
+	const auto loaded = loadGrid(path.string());
+	std::filesystem::remove(path);
+
+	if(!EXPECT(tiled && loaded)) {
+		return testResult();
+	}
+
+	expectSameCells(*loaded, grid);
+	EXPECT(!loaded->tiles() && tiled->tiles());
+
+	// column by column crosses a tile boundary every tileSize cells, only two of the twelve tiles fit
+	for(uint32_t col = 0; col < grid.colCount(); col++) {
+		for(uint32_t row = 0; row < grid.rowCount(); row++) {
+			const uint32_t cell = grid.index(row, col);
+			EXPECT(tiled->isBlock(cell) == grid.isBlock(cell) && tiled->cost(cell) == grid.cost(cell));
+		}
+	}
+
+	EXPECT(tiled->tiles()->residentTiles() <= 2 && tiled->tiles()->tileLoads() > 12);
+	EXPECT(!tiled->failed());
+
+	// every thread searches its own copy, debug builds assert if two of them shared a store
+	std::vector<std::pair<uint32_t, uint32_t>> queries;
+
+	for(int query = 0; query < 16; query++) {
+		queries.push_back({randomOpenCell(grid, generator), randomOpenCell(grid, generator)});
+	}
+
+	std::vector<GridModel> copies(4, *tiled);
+	std::vector<std::vector<uint32_t>> distances(copies.size());
+	std::vector<std::thread> threads;
+
+	for(size_t index = 0; index < copies.size(); index++) {
+		EXPECT(copies[index].tiles() != tiled->tiles() && copies[index].version() == tiled->version());
+		threads.emplace_back([&, index] {
+			for(const auto & [source, target] : queries) {
+				distances[index].push_back(shortestDistance(copies[index], source, target));
+			}
+		});
+	}
+
+	for(auto & thread : threads) {
+		thread.join();
+	}
+
+	for(size_t query = 0; query < queries.size(); query++) {
+		const uint32_t expected = shortestDistance(grid, queries[query].first, queries[query].second);
+
+		for(const auto & distance : distances) {
+			EXPECT(distance[query] == expected);
+		}
+	}
+
+	return testResult();
+}